@@ -0,0 +1,61 @@
+/**
+ * @file EventCalendar.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "EventCalendar.h"
+
+/**
+ * Schedule an event for a product
+ * @param time Conveyor time of the event
+ * @param type What happens
+ * @param product The product it happens to
+ */
+void EventCalendar::Schedule(double time, EventType type, Product *product)
+{
+  mEvents.push({time, type, product, mGenerations[product], mSequence++});
+}
+
+/**
+ * Cancel all of the events scheduled for a product.
+ *
+ * The events stay in the queue but are skipped when they come up.
+ * @param product The product whose events are cancelled
+ */
+void EventCalendar::Cancel(const Product *product)
+{
+  mGenerations[product]++;
+}
+
+/**
+ * Get the next event that happens at or before a time
+ * @param time Conveyor time to run the calendar up to
+ * @param event Set to the next event if there is one
+ * @return True if an event was popped
+ */
+bool EventCalendar::PopNext(double time, Event &event)
+{
+  while (!mEvents.empty() && mEvents.top().mTime <= time)
+  {
+    event = mEvents.top();
+    mEvents.pop();
+
+    if (event.mGeneration == mGenerations[event.mProduct])
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Remove all events from the calendar
+ */
+void EventCalendar::Clear()
+{
+  mEvents = {};
+  mGenerations.clear();
+  mSequence = 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file EventCalendar.h
+ * @author Nitish Maindoliya
+ *
+ * Calendar of the upcoming product events on a conveyor.
+ */
+
+#ifndef EVENTCALENDAR_H
+#define EVENTCALENDAR_H
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+class Product;
+
+/**
+ * Priority queue of the times products will cross into or out of
+ * the beam, the sensor window and the bottom of the game, and of
+ * the times Sparty's boot reaches the belt.
+ *
+ * Products move in a straight line at a constant speed, so all of
+ * these times are known when the conveyor starts. Events are kept
+ * ordered by time and popped when the conveyor time reaches them,
+ * no matter how large the step is.
+ */
+class EventCalendar
+{
+public:
+  /// The kinds of events a product can have
+  enum class EventType
+  {
+    BeamEnter,
+    BeamLeave,
+    SensorEnter,
+    SensorLeave,
+    OffScreen,
+    Kick
+  };
+
+  /**
+   * An event scheduled on the calendar
+   */
+  struct Event
+  {
+    /// Conveyor time the event happens
+    double mTime;
+    /// What happens
+    EventType mType;
+    /// The product it happens to, or nullptr for a kick
+    Product *mProduct;
+    /// Generation of the product when the event was scheduled
+    unsigned mGeneration;
+    /// Order the event was scheduled in, to break ties
+    unsigned mSequence;
+  };
+
+private:
+  /**
+   * Orders events so the earliest one is on top
+   */
+  struct Later
+  {
+    /**
+     * Compare two events
+     * @param a First event
+     * @param b Second event
+     * @return True if a happens after b
+     */
+    bool operator()(const Event &a, const Event &b) const
+    {
+      return a.mTime != b.mTime ? a.mTime > b.mTime : a.mSequence > b.mSequence;
+    }
+  };
+
+  /// The scheduled events, earliest first
+  std::priority_queue<Event, std::vector<Event>, Later> mEvents;
+
+  /// Current generation for each product. Events from an older generation are stale.
+  std::unordered_map<const Product *, unsigned> mGenerations;
+
+  /// Number of events scheduled so far
+  unsigned mSequence = 0;
+
+public:
+  void Schedule(double time, EventType type, Product *product);
+
+  void Cancel(const Product *product);
+
+  bool PopNext(double time, Event &event);
+
+  void Clear();
+
+  /**
+   * Is the calendar empty?
+   * @return True if there are no events left, including stale ones
+   */
+  bool IsEmpty() const { return mEvents.empty(); }
+};
+
+
+#endif // EVENTCALENDAR_H
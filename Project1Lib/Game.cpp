@@ -14,9 +14,12 @@
 #include "Items/Conveyor.h"
 #include "Items/LevelNotice.h"
 #include "Items/Scoreboard.h"
+#include "Items/Product.h"
 #include "Items/Sensor.h"
-#include "Visitors/LevelScoreUpdateVisitor.h"
+#include "Visitors/StaticItemVisitor.h"
+#include "ItemRegistry.h"
 
+#include <cmath>
 #include <sstream>
 
 /// Directory containing level files
@@ -25,6 +28,12 @@ const std::wstring LevelsDirectory = L"resources/levels/";
 /// Directory containing image files
 const std::wstring ImageDirectory = L"resources/images/";
 
+/// Number of production lines at which we update them in parallel
+const size_t ParallelLineCount = 4;
+
+/// Color of the background of the play area
+const wxColour BackgroundColour = wxColour(0xE6, 0xFF, 0xE6);
+
 /**
  * Game constructor
  */
@@ -33,6 +42,18 @@ Game::Game()
   // Initialize the Score object
   mScore = new Score();
 
+  // Products share one image for each content property
+  for (const auto &[property, filename] : Product::PropertiesToContentImages)
+  {
+    const auto index = size_t(property);
+    if (index >= mPropertyImages.size())
+    {
+      mPropertyImages.resize(index + 1);
+    }
+
+    mPropertyImages[index] = GetImage(filename);
+  }
+
   // Load the first level
   LoadLevel(1);
 };
@@ -42,17 +63,26 @@ Game::Game()
  */
 Game::~Game()
 {
+  // Items that observe the score go first. This frees every
+  // level object, so the arenas are empty when they are destroyed.
+  Clear();
+
   // Clean up the Score object
   delete mScore;
 }
 
 /**
- * Draw the game
+ * Draw the game.
+ *
+ * Only the items whose bounds touch the part of the window being
+ * drawn are drawn, over the static layer.
  * @param graphics Graphics device to draw on
  * @param width Width of the window
  * @param height Height of the window
+ * @param update Part of the window to draw, or empty for all of it
  */
-void Game::OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, const int width, const int height)
+void Game::OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, const int width, const int height,
+                  const wxRect &update)
 {
   // Determine the size of the playing area in pixels
   const int pixelWidth = mHeight;
@@ -72,46 +102,76 @@ void Game::OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, const int
     mYOffset = (double)((height - pixelHeight * mScale) / 2.0);
   }
 
+  mWindowSize = wxSize(width, height);
+
+  if (mStaticDirty || mStaticSize != mWindowSize || graphics->GetRenderer() != mStaticRenderer)
+  {
+    DrawStaticLayer(graphics, width, height);
+  }
+
+  // The part of the window to draw and the same area in virtual pixels
+  const wxRect window = update.IsEmpty() ? wxRect(0, 0, width, height) : update;
+  const int left = int(std::floor((window.x - mXOffset) / mScale));
+  const int top = int(std::floor((window.y - mYOffset) / mScale));
+  const wxRect area(left, top, int(std::ceil((window.x + window.width - mXOffset) / mScale)) - left + 1,
+                    int(std::ceil((window.y + window.height - mYOffset) / mScale)) - top + 1);
+
   graphics->PushState();
 
+  graphics->Clip(window.x, window.y, window.width, window.height);
+  graphics->DrawBitmap(mStaticLayer, 0, 0, width, height);
+
   graphics->Translate(mXOffset, mYOffset);
   graphics->Scale(mScale, mScale);
 
   graphics->Clip(0, 0, pixelWidth, pixelHeight); // Clip to the game window's dimensions
 
-  // Draw background
-  wxBrush background(wxColour(0xE6, 0xFF, 0xE6));
-  graphics->SetBrush(background);
-  graphics->DrawRectangle(0, 0, pixelWidth, pixelHeight);
-
   // Reset the pen to remove any outlines
-  graphics->SetPen(*wxTRANSPARENT_PEN);
+  graphics->SetPen(mResources.GetPen(graphics, wxTransparentColour));
 
-  // Draw in layers:
-  // 1. First draw non-product, non-beam items
-  for (const auto &item : mItems)
+  // Draw in layers over the static layer:
+  // 1. First draw the decor and then the gates in z-order
+  for (const auto &item : mDecor)
   {
-    if (!dynamic_cast<Product *>(item.get()) && !dynamic_cast<Beam *>(item.get()))
+    if (item->GetBounds().Intersects(area))
     {
       item->Draw(graphics);
     }
   }
 
+  for (const auto &gate : mGates)
+  {
+    if (gate->GetBounds().Intersects(area))
+    {
+      gate->Draw(graphics);
+    }
+  }
+
   // 2. Draw beams
-  for (const auto &item : mItems)
+  for (const auto &beam : mBeams)
   {
-    if (dynamic_cast<Beam *>(item.get()))
+    if (beam->GetBounds().Intersects(area))
     {
-      item->Draw(graphics);
+      beam->Draw(graphics);
     }
   }
 
-  // 3. Finally draw products on top
-  for (const auto &item : mItems)
+  // 3. Draw products on top. The conveyor's bounds include
+  // everywhere its products can be.
+  for (const auto &line : mLines)
   {
-    if (dynamic_cast<Product *>(item.get()))
+    if (line->GetConveyor() != nullptr && line->GetConveyor()->GetBounds().Intersects(area))
     {
-      item->Draw(graphics);
+      line->GetConveyor()->DrawProducts(graphics);
+    }
+  }
+
+  // 4. Finally the level notices over everything
+  for (const auto &notice : mNotices)
+  {
+    if (notice->GetBounds().Intersects(area))
+    {
+      notice->Draw(graphics);
     }
   }
 
@@ -119,10 +179,244 @@ void Game::OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, const int
 }
 
 /**
- * Add item to the game
+ * Get the part of the window that has to be drawn again because
+ * of what has changed since the last call, and start over.
+ * @return Rectangle in window pixels, empty if nothing changed
+ */
+wxRect Game::TakeDirtyRect()
+{
+  wxRect dirty;
+  if (mDirtyAll)
+  {
+    dirty = wxRect(0, 0, mWindowSize.GetWidth(), mWindowSize.GetHeight());
+  }
+  else if (!mDirty.IsEmpty())
+  {
+    const int left = int(std::floor(mDirty.x * mScale + mXOffset));
+    const int top = int(std::floor(mDirty.y * mScale + mYOffset));
+    dirty = wxRect(left, top, int(std::ceil((mDirty.x + mDirty.width) * mScale + mXOffset)) - left,
+                   int(std::ceil((mDirty.y + mDirty.height) * mScale + mYOffset)) - top);
+
+    // Room for antialiasing at the edges
+    dirty.Inflate(2);
+  }
+
+  mDirty = wxRect();
+  mDirtyAll = false;
+  return dirty;
+}
+
+/**
+ * Draw the parts of the scene that rarely change into the
+ * static layer, at the window's size and the game's scale.
+ *
+ * The layer is the background and whatever the items draw in
+ * DrawStatic, in the same order the items are drawn in. It is
+ * made with the same renderer as the window so it can be drawn
+ * without converting it.
+ * @param graphics Graphics context for the window
+ * @param width Width of the window
+ * @param height Height of the window
+ */
+void Game::DrawStaticLayer(const std::shared_ptr<wxGraphicsContext> &graphics, int width, int height)
+{
+  // Determine the size of the playing area in pixels
+  const int pixelWidth = mHeight;
+  const int pixelHeight = mWidth;
+
+  wxBitmap bitmap(std::max(1, width), std::max(1, height));
+
+  {
+    wxMemoryDC dc(bitmap);
+    dc.SetBackground(wxBrush(*wxBLACK));
+    dc.Clear();
+
+    auto layer = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
+
+    layer->Translate(mXOffset, mYOffset);
+    layer->Scale(mScale, mScale);
+    layer->Clip(0, 0, pixelWidth, pixelHeight);
+
+    // Draw background
+    layer->SetBrush(mResources.GetBrush(layer, BackgroundColour));
+    layer->DrawRectangle(0, 0, pixelWidth, pixelHeight);
+
+    layer->SetPen(mResources.GetPen(layer, wxTransparentColour));
+
+    for (const auto &item : mDecor)
+    {
+      item->DrawStatic(layer);
+    }
+
+    for (const auto &gate : mGates)
+    {
+      gate->DrawStatic(layer);
+    }
+
+    for (const auto &beam : mBeams)
+    {
+      beam->DrawStatic(layer);
+    }
+  }
+
+  mStaticLayer = graphics->CreateBitmap(bitmap);
+  mStaticRenderer = graphics->GetRenderer();
+  mStaticSize = wxSize(width, height);
+  mStaticDirty = false;
+}
+
+/**
+ * Add item to the game.
+ *
+ * While the game is updating the item is added once the
+ * update is done, so nothing being iterated over changes.
  * @param item Item to add
  */
-void Game::Add(const std::shared_ptr<Item> &item) { mItems.push_back(item); }
+void Game::Add(const std::shared_ptr<Item> &item)
+{
+  if (mUpdating)
+  {
+    mPendingAdds.push_back(item);
+    return;
+  }
+
+  Insert(item);
+}
+
+/**
+ * Remove an item from the game.
+ *
+ * While the game is updating the item is removed once the
+ * update is done.
+ * @param item Item to remove
+ */
+void Game::Remove(Item *item)
+{
+  if (mUpdating)
+  {
+    mPendingRemoves.push_back(item);
+    return;
+  }
+
+  Erase(item);
+}
+
+/**
+ * Put an item into the container for its kind.
+ *
+ * The item is sorted here, once, so drawing and updating
+ * never have to check types.
+ * @param item Item to insert
+ */
+void Game::Insert(const std::shared_ptr<Item> &item)
+{
+  item->SetHandle(mItemSlots.Insert(item.get()));
+  Damage(item->GetBounds());
+
+  if (item->HasStaticPart())
+  {
+    mStaticDirty = true;
+  }
+
+  if (auto beam = std::dynamic_pointer_cast<Beam>(item); beam != nullptr)
+  {
+    mBeams.push_back(beam);
+  }
+  else if (auto gate = std::dynamic_pointer_cast<Gate>(item); gate != nullptr)
+  {
+    mGates.push_back(gate);
+  }
+  else if (auto notice = std::dynamic_pointer_cast<LevelNotice>(item); notice != nullptr)
+  {
+    mNotices.push_back(notice);
+  }
+  else
+  {
+    mDecor.push_back(item);
+  }
+}
+
+/**
+ * Take an item out of the container for its kind
+ * @param item Item to erase
+ */
+void Game::Erase(Item *item)
+{
+  Damage(item->GetBounds());
+  mItemSlots.Remove(item->GetHandle());
+  item->SetHandle(Handle());
+
+  if (item->HasStaticPart())
+  {
+    mStaticDirty = true;
+  }
+
+  auto erase = [item](auto &items) {
+    items.erase(std::remove_if(items.begin(), items.end(), [item](const auto &other) { return other.get() == item; }),
+                items.end());
+  };
+
+  erase(mDecor);
+  erase(mGates);
+  erase(mBeams);
+  erase(mNotices);
+}
+
+/**
+ * Apply the adds and removes that were queued during an update
+ */
+void Game::ApplyPending()
+{
+  for (const auto &item : mPendingAdds)
+  {
+    Insert(item);
+  }
+
+  for (auto item : mPendingRemoves)
+  {
+    Erase(item);
+  }
+
+  mPendingAdds.clear();
+  mPendingRemoves.clear();
+}
+
+/**
+ * Start a new arena for a level.
+ *
+ * The objects of the old level usually all went away when the
+ * game was cleared, so its arena is freed in one go. If
+ * something still holds one, the arena is kept until it lets go.
+ */
+void Game::NewArena()
+{
+  mRetiredArenas.push_back(std::move(mArena));
+  mRetiredArenas.erase(std::remove_if(mRetiredArenas.begin(), mRetiredArenas.end(),
+                                      [](const std::unique_ptr<LevelArena> &arena) { return arena->GetLive() == 0; }),
+                       mRetiredArenas.end());
+
+  mArena = std::make_unique<LevelArena>();
+}
+
+/**
+ * Clear the game
+ */
+void Game::Clear()
+{
+  mPendingAdds.clear();
+  mPendingRemoves.clear();
+  ForEachItem([this](Item *item) {
+    mItemSlots.Remove(item->GetHandle());
+    item->SetHandle(Handle());
+  });
+  mDecor.clear();
+  mGates.clear();
+  mBeams.clear();
+  mNotices.clear();
+  mLines.clear();
+  mStaticDirty = true;
+  mDirtyAll = true;
+}
 
 /**
  * Load a level from a file
@@ -131,9 +425,16 @@ void Game::Add(const std::shared_ptr<Item> &item) { mItems.push_back(item); }
 void Game::LoadLevel(const int level)
 {
   mLevel = level;
-  wxXmlDocument xmlDoc;
-  auto filename = LevelsDirectory + L"level" + std::to_wstring(level) + L".xml";
+  Load(LevelsDirectory + L"level" + std::to_wstring(level) + L".xml");
+}
 
+/**
+ * Load a level from a file as the current level
+ * @param filename Level file to load
+ */
+void Game::Load(const std::wstring &filename)
+{
+  wxXmlDocument xmlDoc;
   if (!xmlDoc.Load(filename))
   {
     return;
@@ -141,6 +442,10 @@ void Game::LoadLevel(const int level)
 
   Clear();
 
+  // The level score is the sum of the lines' tallies, and
+  // the new lines have not scored anything yet
+  mScore->Reset();
+
   // Get root and size
   auto root = xmlDoc.GetRoot();
   std::wstring sizeStr = root->GetAttribute(L"size", L"100,100").ToStdWstring();
@@ -148,52 +453,51 @@ void Game::LoadLevel(const int level)
   wchar_t comma;
   sizeStream >> mHeight >> comma >> mWidth;
 
-  // Process items
-  for (auto node = root->GetChildren()->GetChildren(); node; node = node->GetNext())
+  NewArena();
+
+  // Items that are not in a <line> element make up the first line
+  mLines.push_back(std::make_unique<ProductionLine>());
+  LoadItems(root->GetChildren(), mLines.front().get());
+
+  // Add the badge
+  Add(mArena->Make<Badge>(this));
+
+  /// Display the Level begin message
+  Add(mArena->Make<LevelNotice>(this, mLevel, true));
+}
+
+
+/**
+ * Load the items under an XML node
+ * @param parent The XML node
+ * @param line The production line the conveyor, sensor, beam and Sparty belong to
+ */
+void Game::LoadItems(wxXmlNode *parent, ProductionLine *line)
+{
+  for (auto node = parent->GetChildren(); node; node = node->GetNext())
   {
-    std::shared_ptr<Item> item = nullptr;
-    auto name = node->GetName();
+    const auto name = node->GetName().ToStdWstring();
 
     // Create appropriate item type
-    if (name == L"sensor")
+    if (name == L"line")
     {
-      item = std::make_shared<Sensor>(this);
-    }
-    else if (name == L"conveyor")
-    {
-      item = std::make_shared<Conveyor>(this);
-    }
-    else if (name == L"beam")
-    {
-      item = std::make_shared<Beam>(this);
-    }
-    else if (name == L"sparty")
-    {
-      item = std::make_shared<Sparty>(this);
-    }
-    else if (name == L"scoreboard")
-    {
-      item = std::make_shared<Scoreboard>(this, mScore);
+      mLines.push_back(std::make_unique<ProductionLine>());
+      LoadItems(node, mLines.back().get());
+      continue;
     }
 
+    auto item = LevelItemRegistry<LevelItemTypes>::Create(name, this, line);
+
     // Add and load item if created
     if (item != nullptr)
     {
+      item->SetLine(line);
       Add(item);
-      mItems.back()->XmlLoad(node);
+      item->XmlLoad(node);
     }
   }
-
-  // Add the badge
-  const auto badge = std::make_shared<Badge>(this);
-  badge->UpdateBadge(mScore);
-  Add(badge);
-
-  /// Display the Level begin message
-  Add(std::make_shared<LevelNotice>(this, level, true));
 }
 
-
 /**
  * Get an image from the image map
  * @param filename Filename of the image
@@ -219,28 +523,66 @@ std::shared_ptr<wxImage> Game::GetImage(const std::wstring &filename)
   return it->second;
 }
 
+/**
+ * Get the ready to draw bitmap for one of the game's images.
+ *
+ * The bitmap is made at the size the image covers on the screen
+ * at the current scale, so the renderer does not resample it.
+ * @param graphics The graphics context that will draw it
+ * @param image An image from GetImage or GetPropertyImage
+ * @param width Width it is drawn at in virtual pixels
+ * @param height Height it is drawn at in virtual pixels
+ * @param mirror True to mirror the image horizontally
+ * @param quarterTurns Number of clockwise quarter turns, 0 to 3
+ * @return The bitmap
+ */
+const wxGraphicsBitmap &Game::GetSprite(const std::shared_ptr<wxGraphicsContext> &graphics, const wxImage &image,
+                                        double width, double height, bool mirror, int quarterTurns)
+{
+  const int pixelWidth = std::max(1, int(std::lround(width * mScale)));
+  const int pixelHeight = std::max(1, int(std::lround(height * mScale)));
+  return mSprites.Get(graphics, {&image, mirror, quarterTurns & 3, pixelWidth, pixelHeight});
+}
+
 /**
  * Accept a visitor for the collection
  * @param visitor The visitor for the collection
  */
 void Game::Accept(ItemVisitor *visitor) const
 {
-  for (const auto& item : mItems)
+  for (const auto &item : mDecor)
   {
     item->Accept(visitor);
   }
+
+  for (const auto &gate : mGates)
+  {
+    gate->Accept(visitor);
+  }
+
+  for (const auto &beam : mBeams)
+  {
+    beam->Accept(visitor);
+  }
+
+  for (const auto &notice : mNotices)
+  {
+    notice->Accept(visitor);
+  }
 }
 
 /**
- * Test an x,y click location to see if it clicked
- * on some item in the game.
+ * Test an x,y click location against a list of items,
+ * from the last one to the first.
+ * @param items The items to test
  * @param x X location in pixels
  * @param y Y location in pixels
- * @returns Pointer to item we clicked on or nullptr if none.
+ * @returns Pointer to what we clicked on or nullptr if none.
  */
-std::shared_ptr<IDraggable> Game::HitTest(int x, int y)
+template <class T>
+static std::shared_ptr<IDraggable> HitTestItems(const std::vector<std::shared_ptr<T>> &items, int x, int y)
 {
-  for (auto i = mItems.rbegin(); i != mItems.rend(); i++)
+  for (auto i = items.rbegin(); i != items.rend(); i++)
   {
     // Did we click on something contained in the drawable?
     if (auto draggable = (*i)->HitDraggable(x, y); draggable != nullptr)
@@ -257,25 +599,100 @@ std::shared_ptr<IDraggable> Game::HitTest(int x, int y)
   return nullptr;
 }
 
+/**
+ * Test an x,y click location to see if it clicked
+ * on some item in the game.
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @returns Pointer to item we clicked on or nullptr if none.
+ */
+std::shared_ptr<IDraggable> Game::HitTest(int x, int y)
+{
+  // Test from the top layer down
+  if (auto hit = HitTestItems(mBeams, x, y); hit != nullptr)
+  {
+    return hit;
+  }
+
+  if (auto hit = HitTestItems(mGates, x, y); hit != nullptr)
+  {
+    return hit;
+  }
+
+  return HitTestItems(mDecor, x, y);
+}
+
 /**
  * Move an item to the front of the list of items.
  *
  * Removes item from the list and adds it to the end so it
  * will display last.
- * @param item The item to move
+ * @param handle Handle of the item to move
  */
-void Game::MoveToFront(Item *item)
+void Game::MoveToFront(Handle handle)
 {
-  // Find the shared_ptr corresponding to rawPtr
-  auto loc =
-    std::find_if(mItems.begin(), mItems.end(), [item](std::shared_ptr<Item> ptr) { return ptr.get() == item; });
-  auto itemPtr = *loc;
-  if (loc != end(mItems))
+  auto item = mItemSlots.Get(handle);
+  if (item == nullptr)
   {
-    mItems.erase(loc);
+    return;
   }
 
-  mItems.push_back(itemPtr);
+  // Only the gates have a z-order
+  auto loc = std::find_if(mGates.begin(), mGates.end(),
+                          [item](const std::shared_ptr<Gate> &gate) { return gate.get() == item; });
+  if (loc != mGates.end())
+  {
+    std::rotate(loc, loc + 1, mGates.end());
+    Damage(item->GetBounds());
+
+    if (item->HasStaticPart())
+    {
+      mStaticDirty = true;
+    }
+  }
+}
+
+/**
+ * Delete the gate the player added at an x,y location.
+ *
+ * Gates loaded with the level belong to a production line and
+ * can't be deleted. Wires to the deleted gate's pins are left
+ * with stale handles and drop away on their own.
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return True if a gate was deleted
+ */
+bool Game::DeleteGate(int x, int y)
+{
+  for (auto i = mGates.rbegin(); i != mGates.rend(); i++)
+  {
+    if ((*i)->GetLine() == nullptr && (*i)->HitTest(x, y))
+    {
+      Remove(i->get());
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Delete the wire at an x,y location
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return True if a wire was deleted
+ */
+bool Game::DeleteWire(int x, int y)
+{
+  for (auto i = mGates.rbegin(); i != mGates.rend(); i++)
+  {
+    if ((*i)->DeleteWire(x, y))
+    {
+      return true;
+    }
+  }
+
+  return false;
 }
 
 /**
@@ -285,7 +702,8 @@ void Game::MoveToFront(Item *item)
  */
 void Game::TryToCatch(OutputPin *outputPin, wxPoint lineEnd)
 {
-  for (auto i = mItems.rbegin(); i != mItems.rend(); i++)
+  // Only gates have input pins to catch
+  for (auto i = mGates.rbegin(); i != mGates.rend(); i++)
   {
     if ((*i)->Catch(outputPin, lineEnd))
     {
@@ -321,11 +739,15 @@ void Game::Update(double elapsed)
     {
       mEndingLevel = false;
       /// Display the Level end message
-      Add(std::make_shared<LevelNotice>(this, mLevel, false));
+      Add(mArena->Make<LevelNotice>(this, mLevel, false));
 
-      // Update Game and Level Scores
-      LevelScoreUpdateVisitor levelScoreUpdateVisitor;
-      Accept(&levelScoreUpdateVisitor);
+      // Update Game and Level Scores. The lines' tallies are
+      // in the game score now, so they start over too.
+      mScore->EndLevel();
+      for (const auto &line : mLines)
+      {
+        line->Reset();
+      }
     }
   }
 
@@ -347,10 +769,86 @@ void Game::Update(double elapsed)
     }
   }
 
-  for (auto item : mItems)
+  // Items added or removed from here on wait for the end of the tick
+  mUpdating = true;
+
+  // The conveyors move first, then everything else reacts
+  UpdateLines(elapsed);
+
+  for (const auto &item : mDecor)
   {
     item->Update(elapsed);
   }
+
+  for (const auto &beam : mBeams)
+  {
+    beam->Update(elapsed);
+  }
+
+  for (const auto &gate : mGates)
+  {
+    gate->Update(elapsed);
+  }
+
+  for (const auto &notice : mNotices)
+  {
+    notice->Update(elapsed);
+  }
+
+  // Apply the scores from the lines one line at a time. The level
+  // score is the sum of the lines' tallies, so restarting a line
+  // only takes back its own scores. The level ends when every line
+  // with a conveyor has finished.
+  bool hasConveyor = false;
+  bool finished = true;
+  int correct = 0;
+  int incorrect = 0;
+  for (const auto &line : mLines)
+  {
+    line->ApplyOutcomes();
+    correct += line->GetCorrectCount();
+    incorrect += line->GetIncorrectCount();
+    hasConveyor = hasConveyor || line->GetConveyor() != nullptr;
+    finished = finished && line->IsFinished();
+  }
+
+  mScore->SetLevelOutcomes(correct, incorrect);
+
+  if (hasConveyor && finished && !mEndingLevel && !mStartingLevel)
+  {
+    EndLevel();
+  }
+
+  mUpdating = false;
+  ApplyPending();
+}
+
+/**
+ * Update the production lines.
+ *
+ * Lines only touch their own conveyor, products and beam while
+ * they update, so when there are enough of them to be worth it
+ * they are updated in parallel.
+ * @param elapsed The time since the last update
+ */
+void Game::UpdateLines(double elapsed)
+{
+  if (mLines.size() < ParallelLineCount)
+  {
+    for (const auto &line : mLines)
+    {
+      line->Update(elapsed);
+    }
+
+    return;
+  }
+
+  if (mThreadPool == nullptr)
+  {
+    mThreadPool = std::make_unique<ThreadPool>(std::max(1u, std::thread::hardware_concurrency()) - 1);
+  }
+
+  mThreadPool->ParallelFor(mLines.size(), [this, elapsed](size_t i) { mLines[i]->Update(elapsed); });
 }
 
 /**
@@ -14,8 +14,18 @@
 #include "Item.h"
 #include "Gates/Sparty.h"
 #include "Score.h"
-
-#include <deque>
+#include "ProductPool.h"
+#include "ProductionLine.h"
+#include "ThreadPool.h"
+#include "LevelArena.h"
+#include "SlotTable.h"
+#include "WireGraph.h"
+#include "SpriteCache.h"
+#include "GraphicsResources.h"
+
+class wxXmlNode;
+class Beam;
+class LevelNotice;
 
 /**
  * Class that implements a Game
@@ -55,12 +65,106 @@ private:
   /// Map of images
   std::unordered_map<std::wstring, std::shared_ptr<wxImage>> mImages;
 
-  /// The items in the game
-  std::deque<std::shared_ptr<Item>> mItems;
+  /// Image for each product content property, indexed by the
+  /// property and shared by every product with that content
+  std::vector<std::shared_ptr<wxImage>> mPropertyImages;
+
+  /// Bitmaps made from the images for the current renderer
+  SpriteCache mSprites;
+
+  /// Pens, brushes and fonts for the current renderer
+  GraphicsResources mResources;
+
+  /// The parts of the scene that rarely change, drawn at the window's scale
+  wxGraphicsBitmap mStaticLayer;
+
+  /// The renderer the static layer was made with
+  wxGraphicsRenderer *mStaticRenderer = nullptr;
+
+  /// The window size the static layer was drawn for
+  wxSize mStaticSize;
+
+  /// True if the static layer has to be drawn again
+  bool mStaticDirty = true;
+
+  /// The window size at the last draw
+  wxSize mWindowSize;
+
+  /// Area that has to be drawn again, in virtual pixels
+  wxRect mDirty;
+
+  /// True if the whole window has to be drawn again
+  bool mDirtyAll = true;
+
+  /// State of products that are not on a conveyor
+  ProductPool mProductPool;
+
+  /// Memory for the items, pins and wires of the current level
+  std::unique_ptr<LevelArena> mArena = std::make_unique<LevelArena>();
+
+  /// Arenas of earlier levels that still have objects in use
+  std::vector<std::unique_ptr<LevelArena>> mRetiredArenas;
+
+  /// Handles for the items in the game
+  SlotTable<Item> mItemSlots;
+
+  /// Handles for the input pins of the gates
+  SlotTable<InputPin> mInputPinSlots;
+
+  /// Handles for the output pins of the gates
+  SlotTable<OutputPin> mOutputPinSlots;
+
+  /// The wires between the pins
+  WireGraph mWires{mOutputPinSlots, mInputPinSlots};
+
+  /// Items that are drawn under the gates and never move, like the
+  /// conveyors, sensors and scoreboard, in the order they were added
+  std::vector<std::shared_ptr<Item>> mDecor;
+
+  /// The gates other than the beams, in z-order. Later gates are
+  /// drawn on top and a gate that is grabbed moves to the end.
+  std::vector<std::shared_ptr<Gate>> mGates;
+
+  /// The beams, drawn on top of the gates
+  std::vector<std::shared_ptr<Beam>> mBeams;
+
+  /// The level notices, drawn on top of everything
+  std::vector<std::shared_ptr<LevelNotice>> mNotices;
+
+  /// True while the game is updating. Items added or removed
+  /// then are queued and applied when the update is done.
+  bool mUpdating = false;
+
+  /// Items waiting to be added at the end of the update
+  std::vector<std::shared_ptr<Item>> mPendingAdds;
+
+  /// Items waiting to be removed at the end of the update
+  std::vector<Item *> mPendingRemoves;
 
   /// A pointer to the Score object
   Score *mScore;
 
+  /// The production lines in the current level. The first is
+  /// the line for items that are not in a <line> element.
+  std::vector<std::unique_ptr<ProductionLine>> mLines;
+
+  /// Threads for updating production lines, created when first needed
+  std::unique_ptr<ThreadPool> mThreadPool;
+
+  void LoadItems(wxXmlNode *parent, ProductionLine *line);
+
+  void UpdateLines(double elapsed);
+
+  void Insert(const std::shared_ptr<Item> &item);
+
+  void Erase(Item *item);
+
+  void ApplyPending();
+
+  void NewArena();
+
+  void DrawStaticLayer(const std::shared_ptr<wxGraphicsContext> &graphics, int width, int height);
+
 public:
   Game();
 
@@ -69,27 +173,79 @@ public:
    */
   virtual ~Game();
 
-  void OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, int width, int height);
+  void OnDraw(const std::shared_ptr<wxGraphicsContext> &graphics, int width, int height,
+              const wxRect &update = wxRect());
 
-  void Add(const std::shared_ptr<Item> &item);
+  /**
+   * Note that an area has to be drawn again.
+   *
+   * Only call this on the main thread.
+   * @param area Area in virtual pixels
+   */
+  void Damage(const wxRect &area) { mDirty.Union(area); }
+
+  /**
+   * Note that the whole window has to be drawn again
+   */
+  void DamageAll() { mDirtyAll = true; }
+
+  wxRect TakeDirtyRect();
+
+  /**
+   * Get the playing area
+   * @return Playing area in virtual pixels
+   */
+  wxRect GetArea() const
+  {
+    // The level size is read width first into mHeight, see OnDraw
+    return wxRect(0, 0, mHeight, mWidth);
+  }
 
   /**
-   * Clear the game
+   * Have the static layer drawn again before the next frame,
+   * because something an item draws in it has changed
    */
-  void Clear() { mItems.clear(); }
+  void InvalidateStatic() { mStaticDirty = true; }
+
+  void Add(const std::shared_ptr<Item> &item);
+
+  void Remove(Item *item);
+
+  void Clear();
 
   void LoadLevel(int level);
 
+  void Load(const std::wstring &filename);
+
   std::shared_ptr<wxImage> GetImage(const std::wstring &filename);
 
+  const wxGraphicsBitmap &GetSprite(const std::shared_ptr<wxGraphicsContext> &graphics, const wxImage &image,
+                                    double width, double height, bool mirror = false, int quarterTurns = 0);
+
+  /**
+   * Get the pens, brushes and fonts to draw with
+   * @return The graphics resources
+   */
+  GraphicsResources &GetResources() { return mResources; }
+
   void Update(double elapsed);
   bool LevelExists(int level);
 
   void Accept(ItemVisitor *visitor) const;
 
+  template <class Visitor>
+  void Visit(Visitor &visitor) const;
+
+  template <class Function>
+  void ForEachItem(Function function) const;
+
   std::shared_ptr<IDraggable> HitTest(int x, int y);
 
-  void MoveToFront(Item *item);
+  void MoveToFront(Handle handle);
+
+  bool DeleteGate(int x, int y);
+
+  bool DeleteWire(int x, int y);
 
   void TryToCatch(OutputPin *outputPin, wxPoint lineEnd);
   void EndLevel();
@@ -107,10 +263,72 @@ public:
   int GetWidth() const { return mWidth; }
 
   /**
-   * Getter for the items of the game
-   * @return List of items
+   * Get the number of items in the game.
+   *
+   * Products on a conveyor belong to the conveyor and are not counted.
+   * @return Number of items
+   */
+  size_t GetItemCount() const { return mDecor.size() + mGates.size() + mBeams.size() + mNotices.size(); }
+
+  /**
+   * Get the gates other than the beams, in z-order
+   * @return Gates
+   */
+  const std::vector<std::shared_ptr<Gate>> &GetGates() const { return mGates; }
+
+  /**
+   * Get the image shared by the products with a property
+   * @param property The property, as an index
+   * @return Image or nullptr if the property has no image
+   */
+  wxImage *GetPropertyImage(size_t property) const
+  {
+    return property < mPropertyImages.size() ? mPropertyImages[property].get() : nullptr;
+  }
+
+
+  /**
+   * Find an item by its handle
+   * @param handle Handle of the item
+   * @return The item or nullptr if it is no longer in the game
+   */
+  Item *GetItem(Handle handle) const { return mItemSlots.Get(handle); }
+
+  /**
+   * Getter for the handles of the input pins
+   * @return Input pin slot table
+   */
+  SlotTable<InputPin> &GetInputPinSlots() { return mInputPinSlots; }
+
+  /**
+   * Getter for the handles of the output pins
+   * @return Output pin slot table
+   */
+  SlotTable<OutputPin> &GetOutputPinSlots() { return mOutputPinSlots; }
+
+  /**
+   * Getter for the wires between the pins
+   * @return Wire graph
+   */
+  WireGraph &GetWires() { return mWires; }
+
+  /**
+   * Getter for the memory for the objects of the current level
+   * @return Level arena
+   */
+  LevelArena &GetArena() { return *mArena; }
+
+  /**
+   * Getter for the pool for products that are not on a conveyor
+   * @return Product pool
+   */
+  ProductPool &GetProductPool() { return mProductPool; }
+
+  /**
+   * Getter for the production lines in the current level
+   * @return Production lines
    */
-  std::deque<std::shared_ptr<Item>> GetItems() { return mItems; }
+  const std::vector<std::unique_ptr<ProductionLine>> &GetLines() const { return mLines; }
 
   /**
    * Getter for the X offset of the game
@@ -9,14 +9,9 @@
 
 #include "Gate.h"
 #include "ids.h"
-#include "Gates/ORGate.h"
-#include "Gates/NOTGate.h"
-#include "Gates/ANDGate.h"
-#include "Items/Conveyor.h"
-#include "Items/Sensor.h"
+#include "ItemRegistry.h"
 #include "Score.h"
-#include "Gates/DFlipFlop.h"
-#include "Gates/SRFlipFlop.h"
+#include "Visitors/ControlPointVisitor.h"
 
 /// Frame duration in milliseconds
 constexpr int FrameDuration = 30;
@@ -45,6 +40,7 @@ void GameView::Initialize(wxFrame *mainFrame)
   Bind(wxEVT_LEFT_DOWN, &GameView::OnLeftDown, this);
   Bind(wxEVT_LEFT_UP, &GameView::OnMouseMove, this);
   Bind(wxEVT_MOTION, &GameView::OnLeftUp, this);
+  Bind(wxEVT_RIGHT_DOWN, &GameView::OnRightDown, this);
 
 
   mTimer.SetOwner(this);
@@ -58,52 +54,53 @@ void GameView::Initialize(wxFrame *mainFrame)
  */
 void GameView::OnPaint(wxPaintEvent &event)
 {
-  // Compute the time that has elapsed
-  const auto newTime = mStopWatch.Time();
-  auto elapsed = (double)(newTime - mTime) * 0.001;
-  mTime = newTime;
-
   // Create a double-buffered display context
   wxAutoBufferedPaintDC dc(this);
 
-  // Clear the image to black
-  wxBrush background(*wxBLACK);
-  dc.SetBackground(background);
-  dc.Clear();
-
   // Create a graphics context
   auto gc = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(dc));
 
   const wxRect rect = GetRect();
 
-  // Tell the game class to update
-  mGame.Update(elapsed);
-
   // Set (or reset) control points
-  if (mControlPoints)
-  {
-    for (const auto &item : mGame.GetItems())
-    {
-      item->SetControlPoints();
-    }
-  }
-  else
-  {
-    for (const auto &item : mGame.GetItems())
-    {
-      item->ResetControlPoints();
-    }
-  }
+  ControlPointVisitor controlPointVisitor(mControlPoints);
+  mGame.Visit(controlPointVisitor);
 
-  // Tell the game class to draw
-  mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight());
+  // Tell the game class to draw the part of the window that needs it.
+  // The static layer covers the whole window, so nothing has to be
+  // cleared first.
+  mGame.OnDraw(gc, rect.GetWidth(), rect.GetHeight(), GetUpdateRegion().GetBox());
 }
 
 /**
- * Handle a timer event
+ * Handle a timer event by advancing the game and
+ * repainting whatever changed
  * @param event The timer event
  */
-void GameView::OnTimer(wxTimerEvent &event) { Refresh(); }
+void GameView::OnTimer(wxTimerEvent &event)
+{
+  // Compute the time that has elapsed
+  const auto newTime = mStopWatch.Time();
+  auto elapsed = (double)(newTime - mTime) * 0.001;
+  mTime = newTime;
+
+  // Tell the game class to update
+  mGame.Update(elapsed);
+
+  RefreshDirty();
+}
+
+/**
+ * Ask for a repaint of the part of the window the game has damaged
+ */
+void GameView::RefreshDirty()
+{
+  const auto dirty = mGame.TakeDirtyRect();
+  if (!dirty.IsEmpty())
+  {
+    RefreshRect(dirty, false);
+  }
+}
 
 /**
  * Handle a left button mouse press
@@ -121,7 +118,7 @@ void GameView::OnLeftDown(const wxMouseEvent &event)
     // We grabbed something
     // Move it to the front
     mGrabbedItem->MoveToFront();
-    Refresh();
+    RefreshDirty();
   }
 }
 
@@ -152,8 +149,8 @@ void GameView::OnMouseMove(const wxMouseEvent &event)
       mGrabbedItem = nullptr;
     }
 
-    // Force the screen to redraw
-    Refresh();
+    // Redraw where the item was and where it is now
+    RefreshDirty();
   }
 }
 
@@ -163,6 +160,30 @@ void GameView::OnMouseMove(const wxMouseEvent &event)
  */
 void GameView::OnLeftUp(const wxMouseEvent &event) { OnMouseMove(event); }
 
+/**
+ * Handle a right button mouse press by deleting the gate
+ * under the mouse, if the player added it, or else the wire
+ * under the mouse
+ * @param event The mouse event
+ */
+void GameView::OnRightDown(const wxMouseEvent &event)
+{
+  // Leave the gate alone while something is being dragged
+  if (mGrabbedItem != nullptr)
+  {
+    return;
+  }
+
+  // Screen coordinates to virtual coordinates
+  const int vX = (event.GetX() - mGame.GetXOffset()) / mGame.GetScale();
+  const int vY = (event.GetY() - mGame.GetYOffset()) / mGame.GetScale();
+
+  if (mGame.DeleteGate(vX, vY) || mGame.DeleteWire(vX, vY))
+  {
+    RefreshDirty();
+  }
+}
+
 /**
  * Add menus specific to the view
  * @param mainFrame The main frame that owns the menu bar
@@ -187,20 +208,25 @@ void GameView::AddMenus(wxFrame *mainFrame, wxMenu *viewMenu, wxMenu *levelMenu,
   LoadLevelMenuOption(mainFrame, levelMenu, IDM_LEVEL_6, L"&Level 6", L"Play Level 6");
   LoadLevelMenuOption(mainFrame, levelMenu, IDM_LEVEL_7, L"&Level 7", L"Play Level 7");
   LoadLevelMenuOption(mainFrame, levelMenu, IDM_LEVEL_8, L"&Level 8", L"Play Level 8");
+  LoadLevelMenuOption(mainFrame, levelMenu, IDM_LEVEL_9, L"&Level 9", L"Play Level 9");
 
-  // Gates menu options
-  AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_AND, L"&AND", L"Add an AND Gate");
-  AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_OR, L"&OR", L"Add an OR Gate");
-  AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_NOT, L"&NOT", L"Add a NOT Gate");
-  AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_SR_FLIP_FLOP, L"&SR Flip Flop", L"Add an SR Flip Flop Gate");
-  AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_D_FLIP_FLOP, L"&D Flip Flop", L"Add a D Flip Flop Gate");
+  // Gates menu options, one for each gate in the registry
+  const auto &gates = GateMenu<MenuGateTypes>::Entries;
+  for (size_t i = 0; i < gates.size(); i++)
+  {
+    AddGateMenuOption(mainFrame, gatesMenu, IDM_GATES_AND + int(i), gates[i].mText, gates[i].mHelp);
+  }
 }
 
 /**
  * Menu event handler View>Control Points menu option
  * @param event Menu event
  */
-void GameView::OnViewControlPoints(wxCommandEvent &event) { mControlPoints = !mControlPoints; }
+void GameView::OnViewControlPoints(wxCommandEvent &event)
+{
+  mControlPoints = !mControlPoints;
+  Refresh();
+}
 
 /**
  * Update handler for View>Control Points menu option
@@ -259,42 +285,22 @@ void GameView::AddGateMenuOption(wxFrame *mainFrame, wxMenu *menu, const int id,
  */
 void GameView::OnAddGateMenuOption(const wxCommandEvent &event)
 {
-  std::shared_ptr<Gate> gate;
-
-  // Add more cases as different gate classes are ready
-  switch (event.GetId())
-  {
-  case IDM_GATES_OR:
-    // Uncomment or edit once the Gate and ORGate classes are ready
-    gate = std::make_shared<ORGate>(&mGame);
-    break;
-
-  case IDM_GATES_NOT:
-    gate = std::make_shared<NOTGate>(&mGame);
-    break;
-  case IDM_GATES_AND:
-    gate = std::make_shared<ANDGate>(&mGame);
-    break;
-  case IDM_GATES_D_FLIP_FLOP:
-    gate = std::make_shared<DFlipFlop>(&mGame);
-    break;
-  case IDM_GATES_SR_FLIP_FLOP:
-    gate = std::make_shared<SRFlipFlop>(&mGame);
-  }
+  const auto &gates = GateMenu<MenuGateTypes>::Entries;
+  const auto index = size_t(event.GetId() - IDM_GATES_AND);
+  auto gate = index < gates.size() ? gates[index].mCreate(&mGame) : nullptr;
 
   if (gate != nullptr)
   {
     int initialX = InitialX;
     int initialY = InitialY;
 
-    for (auto item : mGame.GetItems())
-    {
+    mGame.ForEachItem([&initialX, &initialY](Item *item) {
       if (item->GetX() == initialX && item->GetY() == initialY)
       {
         initialX += Increment;
         initialY += Increment;
       }
-    }
+    });
 
     gate->SetX(initialX);
     gate->SetY(initialY);
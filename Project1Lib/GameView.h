@@ -28,7 +28,8 @@ private:
   /// The last stopwatch time
   long mTime = 0;
 
-  /// Any item we are currently dragging
+  /// Any item we are currently dragging. It is made in one of the
+  /// game's arenas, so it comes after mGame to be let go of first.
   std::shared_ptr<IDraggable> mGrabbedItem;
 
   bool mControlPoints = false; ///< Display control points?
@@ -38,6 +39,7 @@ private:
   void OnLeftDown(const wxMouseEvent &event);
   void OnMouseMove(const wxMouseEvent &event);
   void OnLeftUp(const wxMouseEvent &event);
+  void OnRightDown(const wxMouseEvent &event);
   void OnViewControlPoints(wxCommandEvent &event);
   void OnUpdateViewControlPoints(wxUpdateUIEvent &event);
   void LoadLevelMenuOption(wxFrame *mainFrame, wxMenu *menu, int id, const std::wstring &text,
@@ -45,6 +47,7 @@ private:
   void AddGateMenuOption(wxFrame *mainFrame, wxMenu *menu, int id, const std::wstring &text, const std::wstring &help);
   void OnLoadLevelMenuOption(const wxCommandEvent &event);
   void OnAddGateMenuOption(const wxCommandEvent &event);
+  void RefreshDirty();
 
 public:
   void Initialize(wxFrame *mainFrame);
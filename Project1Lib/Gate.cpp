@@ -7,32 +7,81 @@
 #include "pch.h"
 #include "Gate.h"
 
+#include "Game.h"
+
 /**
  * Constructor
  * @param game Game this gate is a member of
+ * @param type The kind of gate
  */
-Gate::Gate(Game *game) :
-  Item(game)
+Gate::Gate(Game *game, ItemType type) :
+  Item(game, type)
 {
 }
 
+/**
+ * Add an input pin to the gate
+ * @param location of the pin
+ * @param type the type of pin
+ */
+void Gate::AddInputPin(const wxPoint &location, InputPinTypes type)
+{
+  mInputPins.Emplace(this, location, type);
+}
+
+/**
+ * Add an output pin to the gate
+ * @param location of the pin
+ * @param type the type of pin
+ */
+void Gate::AddOutputPin(const wxPoint &location, OutputPinTypes type)
+{
+  mOutputPins.Emplace(this, location, type);
+}
+
 /**
  * Draw the gate
  * @param gc The graphics context to draw on
  */
 void Gate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
-  for (const auto &inputPin : mInputPins)
+  for (const auto &inputPin : GetInputPins())
   {
-    inputPin->Draw(gc);
+    inputPin.Draw(gc);
   }
 
-  for (const auto &outputPin : mOutputPins)
+  for (auto &outputPin : GetOutputPins())
   {
-    outputPin->Draw(gc);
+    outputPin.Draw(gc);
   }
 }
 
+/**
+ * Get the area the gate, its pins and the wires to and from
+ * them are drawn in
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Gate::GetBounds()
+{
+  wxRect bounds(GetX() - GetWidth() / 2, GetY() - GetHeight() / 2, GetWidth(), GetHeight());
+
+  // Room for the parts of the shapes that stick out, like the
+  // curve of an AND gate and the bubble of a NOT gate
+  bounds.Inflate(std::max(GetWidth(), GetHeight()) / 4 + LineWidth);
+
+  for (const auto &inputPin : GetInputPins())
+  {
+    bounds.Union(inputPin.GetBounds());
+  }
+
+  for (auto &outputPin : GetOutputPins())
+  {
+    bounds.Union(outputPin.GetBounds());
+  }
+
+  return bounds;
+}
+
 /**
  * Test to see if we hit this gate with mouse.
  * @param x X position to test
@@ -68,11 +117,12 @@ bool Gate::HitTest(int x, int y)
  */
 std::shared_ptr<IDraggable> Gate::HitDraggable(int x, int y)
 {
-  for (auto outputPin : mOutputPins)
+  for (auto &outputPin : GetOutputPins())
   {
-    if (outputPin->HitTest(x, y))
+    if (outputPin.HitTest(x, y))
     {
-      return outputPin;
+      // The pin lives inside the gate, so share the gate's ownership
+      return std::shared_ptr<OutputPin>(shared_from_this(), &outputPin);
     }
   }
 
@@ -88,9 +138,9 @@ std::shared_ptr<IDraggable> Gate::HitDraggable(int x, int y)
 bool Gate::Catch(OutputPin *outputPin, wxPoint wireEnd)
 {
   bool output = false;
-  for (const auto& inputPin : mInputPins)
+  for (auto &inputPin : GetInputPins())
   {
-    output = inputPin->Catch(outputPin, wireEnd);
+    output = inputPin.Catch(outputPin, wireEnd);
 
     if (output)
     {
@@ -100,14 +150,34 @@ bool Gate::Catch(OutputPin *outputPin, wxPoint wireEnd)
   return output;
 }
 
+/**
+ * Delete a wire into one of this gate's input pins at an x,y location
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return True if a wire was deleted
+ */
+bool Gate::DeleteWire(int x, int y)
+{
+  for (auto &inputPin : GetInputPins())
+  {
+    if (inputPin.HitTestWire(x, y))
+    {
+      inputPin.Disconnect();
+      return true;
+    }
+  }
+
+  return false;
+}
+
 /**
  * Set the control points associated with this gate
  */
 void Gate::SetControlPoints()
 {
-  for (const auto& outputPin : mOutputPins)
+  for (auto &outputPin : GetOutputPins())
   {
-    outputPin->SetControlPoints();
+    outputPin.SetControlPoints();
   }
 }
 
@@ -116,45 +186,79 @@ void Gate::SetControlPoints()
  */
 void Gate::ResetControlPoints()
 {
-  for (const auto& outputPin : mOutputPins)
+  for (auto &outputPin : GetOutputPins())
   {
-    outputPin->ResetControlPoints();
+    outputPin.ResetControlPoints();
   }
 }
 
+/**
+ * Update the gate.
+ *
+ * The pins take the states of the wires into them and the gate
+ * computes its outputs. If any state changed, the colors of the
+ * gate's wires did too, so it is drawn again.
+ * @param elapsed The time since the last update
+ */
 void Gate::Update(double elapsed)
 {
-  for (const auto& inputPin : mInputPins)
+  for (auto &inputPin : GetInputPins())
   {
-    inputPin->Update();
+    inputPin.Update();
   }
 
   ComputeState();
+
+  if (const auto states = PackStates(); states != mDrawnStates)
+  {
+    mDrawnStates = states;
+    GetGame()->Damage(GetBounds());
+  }
+}
+
+/**
+ * Pack the states of the gate and its pins into one value
+ * @return Two bits for each state
+ */
+uint32_t Gate::PackStates()
+{
+  uint32_t states = uint32_t(GetState());
+  for (const auto &inputPin : GetInputPins())
+  {
+    states = states << 2 | uint32_t(inputPin.GetState());
+  }
+
+  for (const auto &outputPin : GetOutputPins())
+  {
+    states = states << 2 | uint32_t(outputPin.GetState());
+  }
+
+  return states;
 }
 
 void Gate::ComputeState()
 {
   // Default implementation forwards the state of the gate to the output pins
 
-  for (const auto& outputPin : mOutputPins)
+  for (auto &outputPin : GetOutputPins())
   {
-    if (outputPin->GetType() == OutputPinTypes::Regular)
+    if (outputPin.GetType() == OutputPinTypes::Regular)
     {
-      outputPin->SetState(GetState());
+      outputPin.SetState(GetState());
     }
     else
     {
       if (GetState() == States::One)
       {
-        outputPin->SetState(States::Zero);
+        outputPin.SetState(States::Zero);
       }
       else if (GetState() == States::Zero)
       {
-        outputPin->SetState(States::One);
+        outputPin.SetState(States::One);
       }
       else
       {
-        outputPin->SetState(States::Unknown);
+        outputPin.SetState(States::Unknown);
       }
     }
   }
@@ -15,21 +15,35 @@
 #include "States.h"
 #include "InputPin.h"
 #include "OutputPin.h"
+#include "PinArray.h"
 
 /**
  * Class for Gate
  */
 class Gate : public Item
 {
+public:
+  /// Most input pins any kind of gate has
+  static constexpr size_t MaxInputPins = 2;
+
+  /// Most output pins any kind of gate has
+  static constexpr size_t MaxOutputPins = 2;
+
 private:
   /// The state of the gate (Unknown, One, Zero)
   States mState = States::Unknown;
 
   /// The input pins of the gate
-  std::vector<std::shared_ptr<InputPin>> mInputPins;
+  PinArray<InputPin, MaxInputPins> mInputPins;
 
   /// The output pins of the gate
-  std::vector<std::shared_ptr<OutputPin>> mOutputPins;
+  PinArray<OutputPin, MaxOutputPins> mOutputPins;
+
+  /// The states of the gate and its pins when it was last drawn
+  /// again, packed two bits each
+  uint32_t mDrawnStates = ~0u;
+
+  uint32_t PackStates();
 
 public:
   /// Default constructor (disabled)
@@ -41,7 +55,7 @@ public:
   /// Assignment operator
   void operator=(const Gate &) = delete;
 
-  Gate(Game *game);
+  Gate(Game *game, ItemType type);
 
   /**
    * Draw the gate
@@ -51,10 +65,14 @@ public:
 
   bool HitTest(int x, int y) override;
 
+  wxRect GetBounds() override;
+
   std::shared_ptr<IDraggable> HitDraggable(int x, int y) override;
 
   bool Catch(OutputPin *outputPin, wxPoint wireEnd) override;
 
+  bool DeleteWire(int x, int y);
+
   void SetControlPoints() override;
 
   void ResetControlPoints() override;
@@ -70,37 +88,21 @@ public:
    */
   void Release() override {}
 
-  /**
-   * Add an input pin to the gate
-   * @param location of the pin
-   * @param type the type of pin
-   */
-  void AddInputPin(const wxPoint &location, InputPinTypes type = InputPinTypes::Regular)
-  {
-    mInputPins.push_back(std::make_shared<InputPin>(this, location, type));
-  }
+  void AddInputPin(const wxPoint &location, InputPinTypes type = InputPinTypes::Regular);
 
-  /**
-   * Add an output pin to the gate
-   * @param location of the pin
-   * @param type the type of pin
-   */
-  void AddOutputPin(const wxPoint &location, OutputPinTypes type = OutputPinTypes::Regular)
-  {
-    mOutputPins.push_back(std::make_shared<OutputPin>(this, location, type));
-  }
+  void AddOutputPin(const wxPoint &location, OutputPinTypes type = OutputPinTypes::Regular);
 
   /**
    * Get the input pins of this gate
    * @return The input pins of this gate
    */
-  std::vector<std::shared_ptr<InputPin>> GetInputPins() { return mInputPins; }
+  Span<InputPin> GetInputPins() { return mInputPins.GetSpan(); }
 
   /**
    * Get the output pins of this gate
    * @return The output pins of this gate
    */
-  std::vector<std::shared_ptr<OutputPin>> GetOutputPins() { return mOutputPins; }
+  Span<OutputPin> GetOutputPins() { return mOutputPins.GetSpan(); }
 
   /**
    * Compute the output state for a gate (virtual)
@@ -5,6 +5,7 @@
 
 #include "../pch.h"
 #include "ANDGate.h"
+#include "../Game.h"
 #include <cmath>
 
 /// Size of the AND gate in pixels
@@ -24,7 +25,7 @@ const int DistanceBetweenInputPins = 26;
  * @param game Pointer to the game this gate is part of
  */
 ANDGate::ANDGate(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::ANDGate)
 {
   auto width = GetWidth();
   auto height = GetHeight();
@@ -64,8 +65,9 @@ void ANDGate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
   path.AddLineToPoint(topLeft);
   path.CloseSubpath();
 
-  gc->SetPen(*wxBLACK_PEN);
-  gc->SetBrush(*wxWHITE_BRUSH);
+  auto &resources = GetGame()->GetResources();
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
+  gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
 
   gc->DrawPath(path);
 }
@@ -88,10 +90,10 @@ int ANDGate::GetHeight() { return AndGateSize.GetHeight(); }
 void ANDGate::ComputeState()
 {
   States state = States::Unknown;
-  const std::vector<std::shared_ptr<InputPin>> inputPins = GetInputPins();
+  const auto inputPins = GetInputPins();
 
-  const std::shared_ptr<InputPin> &inputPin1 = inputPins[0];
-  const std::shared_ptr<InputPin> &inputPin2 = inputPins[1];
+  const InputPin *inputPin1 = &inputPins[0];
+  const InputPin *inputPin2 = &inputPins[1];
 
   if (inputPin1->GetState() == States::Unknown || inputPin2->GetState() == States::Unknown)
   {
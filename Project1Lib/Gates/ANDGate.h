@@ -36,6 +36,7 @@ public:
   void Accept(ItemVisitor *visitor) override
   {
     visitor->VisitANDGate(this);
+    visitor->VisitGates(this);
   }
 
   void Draw(const std::shared_ptr<wxGraphicsContext> &graphics) override;
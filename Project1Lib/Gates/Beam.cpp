@@ -7,7 +7,6 @@
 #include "../pch.h"
 #include "Beam.h"
 #include "../Game.h"
-#include "../Visitors/BeamProductVisitor.h"
 
 
 /// Image for the beam sender and receiver when red
@@ -23,28 +22,27 @@ const int BeamPinOffset = 80;
 /// Default length of line from the pin
 static const int PinLength = 20;
 
-/// Color to use for drawing a zero connection wire
-const wxColour ConnectionColorZero = *wxBLACK;
-
-/// Color to use for drawing a one connection wire
-const wxColour ConnectionColorOne = *wxRED;
-
-/// Color to use for drawing an unknown state connection wire
-const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
+/// Color of the glow around the laser
+const wxColour LaserGlowColor = wxColour(255, 200, 200, 100);
 
+/// Color of the laser
+const wxColour LaserColor = wxColour(255, 0, 0, 175);
 
 /**
  * Constructor
  * @param game the game that the Beam is a part of
  */
 Beam::Beam(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::Beam)
 {
   // Load the images
   mBeamRedImage = GetGame()->GetImage(BeamRedImage);
   mBeamGreenImage = GetGame()->GetImage(BeamGreenImage);
   mActiveBeamImage = mBeamGreenImage; // Start with green
-  mBeamBroken = false;
+  SetBeamBroken(false);
+
+  // Both images are the same size, so the pin never moves
+  AddOutputPin(wxPoint(mActiveBeamImage->GetWidth() / 2 + BeamPinOffset - PinLength, 0));
 }
 
 /**
@@ -77,69 +75,101 @@ void Beam::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
   // Draw gate components first
   Gate::Draw(gc);
 
-  wxColour color;
-  switch (GetState())
-  {
-  case States::Zero:
-    color = ConnectionColorZero;
-    break;
-  case States::One:
-    color = ConnectionColorOne;
-    break;
-  default:
-    color = ConnectionColorUnknown;
-    break;
-  }
-
   mActiveBeamImage = mBeamBroken ? mBeamRedImage : mBeamGreenImage;
 
   // Draw the glowing line
-  wxPen laser1(wxColour(255, 200, 200, 100), 8);
-  wxPen laser2(wxColour(255, 0, 0, 175), 4);
+  auto &resources = GetGame()->GetResources();
 
   double centerY = GetY() - mActiveBeamImage->GetHeight() / 2 + mActiveBeamImage->GetHeight() / 2;
 
-  gc->SetPen(laser1);
+  gc->SetPen(resources.GetPen(gc, LaserGlowColor, 8));
   gc->StrokeLine(GetX() - mActiveBeamImage->GetWidth() / 2, centerY, GetX() + mSender, centerY);
 
-  gc->SetPen(laser2);
+  gc->SetPen(resources.GetPen(gc, LaserColor, 4));
   gc->StrokeLine(GetX() - mActiveBeamImage->GetWidth() / 2, centerY, GetX() + mSender, centerY);
 
   // Draw the receivers
-  gc->DrawBitmap(mActiveBeamImage->Mirror(), GetX() - mActiveBeamImage->GetWidth() / 2,
-                 GetY() - mActiveBeamImage->GetHeight() / 2, mActiveBeamImage->GetWidth(),
-                 mActiveBeamImage->GetHeight());
+  const double receiverWidth = mActiveBeamImage->GetWidth();
+  const double receiverHeight = mActiveBeamImage->GetHeight();
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *mActiveBeamImage, receiverWidth, receiverHeight, true),
+                 GetX() - mActiveBeamImage->GetWidth() / 2, GetY() - mActiveBeamImage->GetHeight() / 2,
+                 receiverWidth, receiverHeight);
 
-  gc->DrawBitmap(*mActiveBeamImage, GetX() + mSender - mActiveBeamImage->GetWidth() / 2,
-                 GetY() - mActiveBeamImage->GetHeight() / 2, mActiveBeamImage->GetWidth(),
-                 mActiveBeamImage->GetHeight());
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *mActiveBeamImage, receiverWidth, receiverHeight),
+                 GetX() + mSender - mActiveBeamImage->GetWidth() / 2,
+                 GetY() - mActiveBeamImage->GetHeight() / 2, receiverWidth, receiverHeight);
 
   // Draw the line to the pin
-  wxPen BeamPinLine(color, 3);
-  gc->SetPen(BeamPinLine);
+  gc->SetPen(resources.GetPen(gc, WirePath::GetColour(GetState()), LineWidth));
   gc->StrokeLine(GetX() + mActiveBeamImage->GetWidth() / 2, GetY(), GetX() + BeamPinOffset, GetY());
+}
 
-  AddOutputPin(wxPoint(mActiveBeamImage->GetWidth() / 2 + BeamPinOffset - PinLength, 0));
+/**
+ * Get the area the beam is drawn in: the sender, the receiver,
+ * the laser between them and the line to the pin
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Beam::GetBounds()
+{
+  const int width = mActiveBeamImage->GetWidth();
+  const int height = mActiveBeamImage->GetHeight();
+
+  auto bounds = Gate::GetBounds();
+  bounds.Union(wxRect(GetX() - width / 2, GetY() - height / 2, width, height));
+  bounds.Union(wxRect(GetX() + mSender - width / 2, GetY() - height / 2, width, height));
+  bounds.Union(wxRect(GetX(), GetY() - LineWidth, BeamPinOffset, LineWidth * 2));
+  return bounds;
 }
 
 /**
- * Compute the state of the beam
+ * Does the beam cross an X location?
+ * @param x X location in virtual pixels
+ * @return True if x is between the two ends of the beam
  */
-void Beam::ComputeState()
+bool Beam::Spans(double x) const
 {
-  // First reset the state
-  SetBeamBroken(false);
+  const double senderX = GetX() + mSender;
+  return x >= std::min(GetX(), senderX) && x <= std::max(GetX(), senderX);
+}
 
-  if (auto game = GetGame())
-  {
-    BeamProductVisitor visitor(this);
-    game->Accept(&visitor);
+/**
+ * Handle a product breaking the beam
+ * @param product The product that entered the beam
+ */
+void Beam::ProductEntered(Product *product)
+{
+  product->SetBeamHit(true);
+  mProductsInBeam.push_back(product);
+  SetBeamBroken(true);
+}
 
-    if (visitor.FoundIntersection())
-    {
-      SetBeamBroken(true);
-    }
+/**
+ * Handle a product leaving the beam.
+ *
+ * Leaving the beam is when a product is scored. Products that
+ * are not in the beam are ignored.
+ * @param product The product that left the beam
+ */
+void Beam::ProductLeft(Product *product)
+{
+  auto loc = std::find(mProductsInBeam.begin(), mProductsInBeam.end(), product);
+  if (loc == mProductsInBeam.end())
+  {
+    return;
   }
 
-  Gate::ComputeState();
+  mProductsInBeam.erase(loc);
+  SetBeamBroken(!mProductsInBeam.empty());
+
+  product->SetBeamHit(false);
+  product->HasLeftBeam();
+}
+
+/**
+ * Clear the beam when the conveyor restarts
+ */
+void Beam::Reset()
+{
+  mProductsInBeam.clear();
+  SetBeamBroken(false);
 }
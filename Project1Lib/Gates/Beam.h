@@ -9,6 +9,9 @@
 #include "../Gate.h"
 #include "../Items/Product.h"
 
+/// Tolerance in Y for a product to be in the beam in virtual pixels
+static constexpr double BeamYTolerance = 40.0;
+
 /**
  * Class for the beam
  */
@@ -40,6 +43,9 @@ private:
   /// Bool that is true when a product is passing through the beam
   bool mBeamBroken = false;
 
+  /// Products that are in the beam right now
+  std::vector<Product *> mProductsInBeam;
+
 public:
   /// Default constructor (disabled)
   Beam() = delete;
@@ -72,6 +78,8 @@ public:
 
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
+  wxRect GetBounds() override;
+
   /**
    * Set the beam broken state
    * @param broken True if beam is broken
@@ -84,10 +92,13 @@ public:
    */
   bool GetBeamBroken() { return mBeamBroken; }
 
-  /**
-   * Compute the state of the Beam gate
-   */
-  void ComputeState() override;
+  bool Spans(double x) const;
+
+  void ProductEntered(Product *product);
+
+  void ProductLeft(Product *product);
+
+  void Reset();
 
   /**
    * Get the sender for this gate
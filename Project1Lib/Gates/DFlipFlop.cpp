@@ -5,6 +5,7 @@
 
 #include "../pch.h"
 #include "DFlipFlop.h"
+#include "../Game.h"
 
 /// Size of the Flip Flop in pixels
 /// @return Size of the gate
@@ -25,7 +26,7 @@ const int DistanceCircleToGate = 20;
  * @param game Pointer to the game this gate is part of
  */
 DFlipFlop::DFlipFlop(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::DFlipFlop)
 {
   auto width = GetWidth();
   auto height = GetHeight();
@@ -54,7 +55,7 @@ void DFlipFlop::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   Gate::Draw(graphics);
 
   auto path = graphics->CreatePath();
-  auto font = graphics->CreateFont(15, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
+  auto &resources = GetGame()->GetResources();
 
   auto x = GetX();
   auto y = GetY();
@@ -85,10 +86,13 @@ void DFlipFlop::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   path.AddLineToPoint(clockBottom);
 
   // Set pen and brush for the rectangle and the clock triangle
-  graphics->SetPen(*wxBLACK_PEN);
-  graphics->SetBrush(*wxWHITE_BRUSH);
+  graphics->SetPen(resources.GetPen(graphics, *wxBLACK));
+  graphics->SetBrush(resources.GetBrush(graphics, *wxWHITE));
   graphics->DrawPath(path);
 
+  // Font for the labels
+  graphics->SetFont(resources.GetFont(graphics, 15, *wxBLACK));
+
   // Add labels for inputs and outputs inside the rectangle
   graphics->DrawText("D", x - width / 2 + DFlipFlopLabelMargin, y - height / 4 - DFlipFlopLabelMargin * 2);
   graphics->DrawText("Q", x + width / 4 - DFlipFlopLabelMargin, y - height / 4 - DFlipFlopLabelMargin * 2);
@@ -114,18 +118,18 @@ int DFlipFlop::GetWidth() { return DFlipFlopSize.GetWidth(); }
  */
 void DFlipFlop::ComputeState()
 {
-  std::shared_ptr<InputPin> clockPin;
-  std::shared_ptr<InputPin> dPin;
+  InputPin *clockPin = nullptr;
+  InputPin *dPin = nullptr;
 
-  for (const auto &inputPin : GetInputPins())
+  for (auto &inputPin : GetInputPins())
   {
-    if (inputPin->GetType() == InputPinTypes::Clock)
+    if (inputPin.GetType() == InputPinTypes::Clock)
     {
-      clockPin = inputPin;
+      clockPin = &inputPin;
     }
-    else if (inputPin->GetType() == InputPinTypes::Data)
+    else if (inputPin.GetType() == InputPinTypes::Data)
     {
-      dPin = inputPin;
+      dPin = &inputPin;
     }
   }
 
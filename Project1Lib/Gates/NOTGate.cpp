@@ -6,6 +6,7 @@
 
 #include "../pch.h"
 #include "NOTGate.h"
+#include "../Game.h"
 
 /// Set the size of the NOT gate in pixels
 /// @return Size of the NOT gate
@@ -20,7 +21,7 @@ const double CircleRadius = 4.0;
  * @param game Pointer to the game this gate is part of
  */
 NOTGate::NOTGate(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::NOTGate)
 {
   auto width = GetWidth();
 
@@ -58,8 +59,9 @@ void NOTGate::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   path.CloseSubpath(); // Close the triangle shape
 
   // Draw the path
-  graphics->SetPen(*wxBLACK_PEN);
-  graphics->SetBrush(*wxWHITE_BRUSH);
+  auto &resources = GetGame()->GetResources();
+  graphics->SetPen(resources.GetPen(graphics, *wxBLACK));
+  graphics->SetBrush(resources.GetBrush(graphics, *wxWHITE));
   graphics->DrawPath(path);
 
   // Draw the circle for the NOT gate
@@ -92,7 +94,7 @@ int NOTGate::GetHeight()
  */
 void NOTGate::ComputeState()
 {
-  auto input = GetInputPins()[0]->GetState();
+  auto input = GetInputPins()[0].GetState();
 
   if (input == States::One)
   {
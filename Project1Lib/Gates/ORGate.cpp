@@ -6,6 +6,7 @@
 
 #include "../pch.h"
 #include "ORGate.h"
+#include "../Game.h"
 
 /// Set the gate size
 /// @return Size of the gate
@@ -22,7 +23,7 @@ const int DistanceBetweenInputPins = 26;
  * @param game Pointer to the game this gate is part of
  */
 ORGate::ORGate(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::ORGate)
 {
   auto width = GetWidth();
   auto height = GetHeight();
@@ -70,8 +71,9 @@ void ORGate::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   path.CloseSubpath();
 
   // Set the pen and brush for the gate drawing
-  graphics->SetPen(*wxBLACK_PEN);
-  graphics->SetBrush(*wxWHITE_BRUSH);
+  auto &resources = GetGame()->GetResources();
+  graphics->SetPen(resources.GetPen(graphics, *wxBLACK));
+  graphics->SetBrush(resources.GetBrush(graphics, *wxWHITE));
 
   // Draw the OR gate shape
   graphics->DrawPath(path);
@@ -95,10 +97,10 @@ int ORGate::GetHeight() { return OrGateSize.GetHeight(); }
 void ORGate::ComputeState()
 {
   States state = States::Unknown;
-  const std::vector<std::shared_ptr<InputPin>> inputPins = GetInputPins();
+  const auto inputPins = GetInputPins();
 
-  const std::shared_ptr<InputPin> &inputPin1 = inputPins[0];
-  const std::shared_ptr<InputPin> &inputPin2 = inputPins[1];
+  const InputPin *inputPin1 = &inputPins[0];
+  const InputPin *inputPin2 = &inputPins[1];
 
   if (inputPin1->GetState() == States::Unknown || inputPin2->GetState() == States::Unknown)
   {
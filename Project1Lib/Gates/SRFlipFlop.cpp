@@ -5,6 +5,7 @@
 
 #include "../pch.h"
 #include "SRFlipFlop.h"
+#include "../Game.h"
 
 /// Size of the Flip Flop in pixels
 /// @return The size of the Flip Flop
@@ -21,7 +22,7 @@ const int DistanceCircleToGate = 20;
  * @param game Pointer to the game this gate is part of
  */
 SRFlipFlop::SRFlipFlop(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::SRFlipFlop)
 {
   auto width = GetWidth();
   auto height = GetHeight();
@@ -44,7 +45,7 @@ void SRFlipFlop::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   Gate::Draw(graphics);
 
   auto path = graphics->CreatePath();
-  auto font = graphics->CreateFont(15, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
+  auto &resources = GetGame()->GetResources();
 
   auto x = GetX();
   auto y = GetY();
@@ -65,10 +66,13 @@ void SRFlipFlop::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
   path.CloseSubpath();
 
   // Set pen and brush for the rectangle and the clock triangle
-  graphics->SetPen(*wxBLACK_PEN);
-  graphics->SetBrush(*wxWHITE_BRUSH);
+  graphics->SetPen(resources.GetPen(graphics, *wxBLACK));
+  graphics->SetBrush(resources.GetBrush(graphics, *wxWHITE));
   graphics->DrawPath(path);
 
+  // Font for the labels
+  graphics->SetFont(resources.GetFont(graphics, 15, *wxBLACK));
+
   // Add labels for inputs and outputs inside the rectangle
   graphics->DrawText("S", x - width / 2 + SRFlipFlopLabelMargin, y - height / 4 - SRFlipFlopLabelMargin * 2);
   graphics->DrawText("R", x - width / 2 + SRFlipFlopLabelMargin, y + height / 4 - SRFlipFlopLabelMargin * 2);
@@ -88,18 +92,18 @@ int SRFlipFlop::GetWidth() { return SRFlipFlopSize.GetWidth(); }
  */
 void SRFlipFlop::ComputeState()
 {
-  std::shared_ptr<InputPin> setPin;
-  std::shared_ptr<InputPin> resetPin;
+  InputPin *setPin = nullptr;
+  InputPin *resetPin = nullptr;
 
-  for (auto pin : GetInputPins())
+  for (auto &pin : GetInputPins())
   {
-    if (pin->GetType() == InputPinTypes::Set)
+    if (pin.GetType() == InputPinTypes::Set)
     {
-      setPin = pin;
+      setPin = &pin;
     }
-    else if (pin->GetType() == InputPinTypes::Reset)
+    else if (pin.GetType() == InputPinTypes::Reset)
     {
-      resetPin = pin;
+      resetPin = &pin;
     }
   }
 
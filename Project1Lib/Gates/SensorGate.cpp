@@ -8,7 +8,6 @@
 #include "../Game.h"
 #include "../Items/Product.h"
 #include "../Items/Sensor.h"
-#include "../Visitors/SensorVisitor.h"
 
 /// Size of the SensorGate in pixels
 /// @returns the size of the SensorGate
@@ -40,7 +39,8 @@ const std::map<Product::Properties, std::wstring> images = {{Product::Properties
  * @param game Pointer to the game this sensor gate is part of
  * @param property Pointer to specific property associated with this gate
  */
-SensorGate::SensorGate(Game *game, Product::Properties property) : Gate(game), mProperty(property)
+SensorGate::SensorGate(Game *game, Product::Properties property) :
+    Gate(game, ItemType::SensorGate), mProperty(property), mMask(Product::PropertyBit(property))
 {
   // Load the appropriate image for the content
   auto iter = images.find(mProperty);
@@ -52,13 +52,11 @@ SensorGate::SensorGate(Game *game, Product::Properties property) : Gate(game), m
 }
 
 /**
- * Draw the Sensor gate.
- * Override this method to draw the Sensor gate based on the output state.
+ * Draw the panel of the Sensor gate.
  * @param gc Graphics context for drawing
  */
-void SensorGate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+void SensorGate::DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc)
 {
-  Gate::Draw(gc);
   // Save the graphics state
   gc->PushState();
 
@@ -70,40 +68,41 @@ void SensorGate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
   // Calculate the size of the shape
   double size = std::stod(PanelDefaultSize);
 
-  gc->SetPen(*wxBLACK_PEN);
+  auto &resources = GetGame()->GetResources();
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
 
   // Set the color based on the product's color property for the overlay shapes
   switch (mProperty)
   {
   case Product::Properties::Red:
-    gc->SetBrush(wxBrush(OhioStateRed));
+    gc->SetBrush(resources.GetBrush(gc, OhioStateRed));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Green:
-    gc->SetBrush(wxBrush(MSUGreen));
+    gc->SetBrush(resources.GetBrush(gc, MSUGreen));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Blue:
-    gc->SetBrush(wxBrush(UofMBlue));
+    gc->SetBrush(resources.GetBrush(gc, UofMBlue));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Square:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
-    gc->SetBrush(*wxWHITE_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
     gc->DrawRectangle(x - size / 2.0, y - size / 2.0, size, size);
     break;
   case Product::Properties::Circle:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
-    gc->SetBrush(*wxWHITE_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
     gc->DrawEllipse(x - size / 2.0, y - size / 2.0, size, size);
     break;
   case Product::Properties::Diamond:
     {
-      gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+      gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
       gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
-      gc->SetBrush(*wxWHITE_BRUSH);
+      gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
       // Create a path for a diamond (rotated square)
       wxGraphicsPath path = gc->CreatePath();
       path.MoveToPoint(x, y - size / 2); // Top
@@ -115,29 +114,30 @@ void SensorGate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
       break;
     }
   case Product::Properties::Izzo:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Smith:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Basketball:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   case Product::Properties::Football:
-    gc->SetBrush(*wxLIGHT_GREY_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxLIGHT_GREY));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   default:
-    gc->SetBrush(*wxWHITE_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
     gc->DrawRectangle(x - width / 2.0, y - height / 2.0, width, height);
     break;
   }
   if (mProperty != Product::Properties::None && mSensorImage)
   {
-    gc->DrawBitmap(*mSensorImage, x - size / 2.0, y - size / 2.0, size, size);
+    gc->DrawBitmap(GetGame()->GetSprite(gc, *mSensorImage, size, size), x - size / 2.0, y - size / 2.0, size,
+                   size);
   }
 
   // Restore the graphics state
@@ -146,28 +146,15 @@ void SensorGate::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 
 
 /**
- * Compute the output state of the Sensor Gate
+ * Compute the output state of the Sensor Gate.
+ *
+ * The gate is one when the product the sensor sampled this
+ * tick has the gate's property.
  */
 void SensorGate::ComputeState()
 {
-  States state = States::Unknown;
-
-  SensorVisitor visitor(this);
-  auto items = GetGame()->GetItems();
-  for (auto it = items.rbegin(); it != items.rend(); ++it)
-  {
-    (*it)->Accept(&visitor);
-    if (visitor.IsMatchingProduct())
-    {
-      state = States::One;
-    }
-    else
-    {
-      state = States::Zero;
-    }
-  }
-
-  SetState(state);
+  const bool match = mSensor != nullptr && (mSensor->GetSample() & mMask) != 0;
+  SetState(match ? States::One : States::Zero);
 
   Gate::ComputeState();
 }
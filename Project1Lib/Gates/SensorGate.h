@@ -11,6 +11,14 @@
 #include "../Items/Product.h"
 #include <memory>
 
+class Sensor;
+
+/// Distance above the beam that the sensor can see products in virtual pixels
+static constexpr double SensorTopYTolerance = 100.0;
+
+/// Distance below the beam that the sensor can see products in virtual pixels
+static constexpr double SensorBottomYTolerance = 40.0;
+
 /**
  * Class for the sensor gate
  */
@@ -32,14 +40,24 @@ public:
    * Accept a visitor
    * @param visitor The visitor we accept
    */
-  void Accept(ItemVisitor *visitor) override { visitor->VisitSensorGate(this); }
+  void Accept(ItemVisitor *visitor) override
+  {
+    visitor->VisitSensorGate(this);
+    visitor->VisitGates(this);
+  }
 
   /**
-   * Draw the Sensor gate.
-   * Override this method to draw the Sensor gate based on the output state.
+   * Draw the panel of the Sensor gate.
+   * The panel shows the property the gate senses and never changes.
    * @param gc Graphics context for drawing
    */
-  void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
+  void DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc) override;
+
+  /**
+   * Does this item draw anything in the static layer?
+   * @return True
+   */
+  bool HasStaticPart() const override { return true; }
 
   int GetWidth() override;
 
@@ -61,9 +79,19 @@ public:
    */
   Product::Properties GetProperty() const { return mProperty; }
 
+  /**
+   * Set the sensor this gate reads from
+   * @param sensor The sensor
+   */
+  void SetSensor(Sensor *sensor) { mSensor = sensor; }
+
 private:
   /// The property associated with this gate (e.g., color, shape, or content)
   Product::Properties mProperty;
+  /// Property mask with only this gate's property set
+  uint32_t mMask;
+  /// The sensor this gate reads from
+  Sensor *mSensor = nullptr;
   /// The product image
   std::shared_ptr<wxImage> mSensorImage;
 };
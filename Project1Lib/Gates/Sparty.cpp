@@ -8,7 +8,9 @@
 #include "Sparty.h"
 #include "../Game.h"
 #include "../Items/Product.h"
-#include "../Visitors/KickVisitor.h"
+#include "../Items/Conveyor.h"
+#include "Beam.h"
+#include "../ProductionLine.h"
 
 /// Image for the sparty background, what is behind the boot
 const std::wstring SpartyBackImage = L"sparty-back.png";
@@ -36,22 +38,12 @@ const double SpartyKickPoint = 0.35;
 /// way from the top of the Sparty image.
 const double SpartyBootPercentage = 1;
 
-/// Color to use for drawing a zero connection wire
-const wxColour ConnectionColorZero = *wxBLACK;
-
-/// Color to use for drawing a one connection wire
-const wxColour ConnectionColorOne = *wxRED;
-
-/// Color to use for drawing an unknown state connection wire
-const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
-
-
 /**
  * Constructor
  * @param game Game this item is a member of
  */
 Sparty::Sparty(Game *game) :
-  Gate(game)
+  Gate(game, ItemType::Sparty)
 {
 }
 
@@ -68,38 +60,18 @@ void Sparty::XmlLoad(wxXmlNode *node)
 }
 
 /**
- * Draw the Sparty
+ * Draw the wire to Sparty's pin, Sparty and the kicking boot.
+ *
+ * The wire changes color with Sparty's state, so it is not in
+ * the static layer. Sparty's body is drawn over the end of it.
  * @param gc The graphics context to draw on
  */
 void Sparty::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
   Gate::Draw(gc);
 
-  wxColour color;
-  switch (GetState())
-  {
-  case States::Zero:
-    color = ConnectionColorZero;
-    break;
-  case States::One:
-    color = ConnectionColorOne;
-    break;
-  default:
-    color = ConnectionColorUnknown;
-    break;
-  }
-
-  // Draw the Sparty background
-  auto spartyBack = GetGame()->GetImage(SpartyBackImage);
-  int height = mHeight;
-  int width = height * spartyBack->GetWidth() / spartyBack->GetHeight();
-  gc->DrawBitmap(*spartyBack, GetX() - width / 2, GetY() - height / 2, width, height);
-
-  // Draw the kicking boot
-  DrawBoot(gc, width, height);
-
   // Define pen for the lines (wires)
-  gc->SetPen(wxPen(color, LineWidth));
+  gc->SetPen(GetGame()->GetResources().GetPen(gc, WirePath::GetColour(GetState()), LineWidth));
 
   // Draw each line segment separately
   gc->StrokeLine(GetX(), GetY(), GetX() + 80, GetY());
@@ -107,16 +79,20 @@ void Sparty::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
   gc->StrokeLine(GetX() + 80, GetY() - 320, mPinX, GetY() - 320);
   gc->StrokeLine(mPinX, GetY() - 320, mPinX, mPinY);
 
-  // Draw the background image for Sparty
-  gc->DrawBitmap(*spartyBack, GetX() - width / 2, GetY() - height / 2, width, height);
+  // Draw the background image for Sparty over the end of the wire
+  auto spartyBack = GetGame()->GetImage(SpartyBackImage);
+  int height = mHeight;
+  int width = height * spartyBack->GetWidth() / spartyBack->GetHeight();
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *spartyBack, width, height), GetX() - width / 2, GetY() - height / 2,
+                 width, height);
 
   // Draw the kicking boot with rotation (if any) - this may involve additional calculations for positioning
   DrawBoot(gc, width, height);
 
   // Draw the Sparty foreground image (SpartyFrontImage)
   auto spartyFront = GetGame()->GetImage(SpartyFrontImage);
-  gc->DrawBitmap(*spartyFront, GetX() - width / 2, GetY() - height / 2, width, height);
-
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *spartyFront, width, height), GetX() - width / 2, GetY() - height / 2,
+                 width, height);
 }
 
 /**
@@ -143,8 +119,8 @@ void Sparty::DrawBoot(const std::shared_ptr<wxGraphicsContext> &gc, int width, i
   gc->Rotate(bootAngle);
 
   // Draw the boot image
-  gc->DrawBitmap(*spartyBoot, -bootWidth * SpartyBootPivot.m_x, -bootHeight * SpartyBootPivot.m_y, bootWidth,
-                 bootHeight);
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *spartyBoot, bootWidth, bootHeight), -bootWidth * SpartyBootPivot.m_x,
+                 -bootHeight * SpartyBootPivot.m_y, bootWidth, bootHeight);
 
   // Restore graphics context state
   gc->PopState();
@@ -195,6 +171,35 @@ void Sparty::Kick()
   mKickTime = 0;
 }
 
+/**
+ * Get the area Sparty is drawn in: the body, the wire to the pin
+ * and everywhere the boot can swing to
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Sparty::GetBounds()
+{
+  auto spartyBack = GetGame()->GetImage(SpartyBackImage);
+  const int height = mHeight;
+  const int width = height * spartyBack->GetWidth() / spartyBack->GetHeight();
+
+  auto bounds = Gate::GetBounds();
+  bounds.Union(wxRect(GetX() - width / 2, GetY() - height / 2, width, height));
+
+  // The wire runs right, up and across to the pin
+  const int wireTop = std::min(GetY() - 320, mPinY);
+  bounds.Union(wxRect(GetX(), wireTop, mPinX - GetX(), GetY() - wireTop).Inflate(LineWidth));
+
+  // The boot turns about its pivot, so it stays in a circle around it
+  auto spartyBoot = GetGame()->GetImage(SpartyBootImage);
+  const int bootWidth = height * spartyBoot->GetWidth() / spartyBoot->GetHeight();
+  const int pivotX = GetX() - bootWidth / 2 + bootWidth * SpartyBootPivot.m_x;
+  const int pivotY = GetY() + height / 2 - height * SpartyBootPercentage + height * SpartyBootPivot.m_y;
+  const int reach = int(std::ceil(std::hypot(bootWidth, height)));
+  bounds.Union(wxRect(pivotX - reach, pivotY - reach, reach * 2, reach * 2));
+
+  return bounds;
+}
+
 /**
  * Update the Sparty (for animation and logic)
  * @param elapsed The time since the last update
@@ -205,53 +210,36 @@ void Sparty::Update(double elapsed)
 
   if (mKicking)
   {
+    // The boot moves every tick of the kick
+    GetGame()->Damage(GetBounds());
+
     // Add the elapsed time to the kick timer
     mKickTime += elapsed;
 
-    // Check if we are past the kick point in the animation
-    if (mKickTime >= mKickDuration * SpartyKickPoint && !mProductKicked)
-    {
-      // Normally, we would check for a product to kick here, but for now we skip it
-      mProductKicked = true;
-    }
-
     // Stop the kick when the animation is complete
     if (mKickTime >= mKickDuration)
     {
       mKicking = false;
-      mProductKicked = false;
       mKickTime = 0; // Reset the kick timer for the next kick
     }
   }
 }
 
-/**
- * Kick product from conveyor
- * @param product The product to be kicked
- */
-void Sparty::KickProduct(std::shared_ptr<Product> product)
-{
-  if (!mProductKicked && product)
-  {
-    //product->MoveLeft(); // Kicks the product to the left by calling its MoveLeft method
-    mProductKicked = true; // Ensures only one kick per cycle
-  }
-}
-
 /**
  * Compute the output state of Sparty
  */
 void Sparty::ComputeState()
 {
-  auto newState = GetInputPins()[0]->GetState();
+  auto newState = GetInputPins()[0].GetState();
   if (GetState() != States::One && newState == States::One)
   {
     Kick();
-    KickVisitor kickVisitor(this);
-    auto items = GetGame()->GetItems();
-    for (auto it = items.rbegin(); it != items.rend(); ++it)
+
+    // The product is kicked when the boot reaches the belt
+    auto line = GetLine();
+    if (line != nullptr && line->GetConveyor() != nullptr)
     {
-      (*it)->Accept(&kickVisitor);
+      line->GetConveyor()->ScheduleKick(mKickDuration * SpartyKickPoint);
     }
   }
   SetState(newState);
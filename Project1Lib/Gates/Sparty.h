@@ -31,8 +31,6 @@ private:
   bool mKicking = false;
   /// Time duration of the kick
   double mKickTime = 0;
-  /// Animation completion
-  bool mProductKicked = false;
 
 public:
   /// Default constructor (disabled)
@@ -60,12 +58,12 @@ public:
 
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
+  wxRect GetBounds() override;
+
   void Update(double elapsed) override;
 
   void Kick();
 
-  void KickProduct(std::shared_ptr<Product> product);
-
   void DrawBoot(const std::shared_ptr<wxGraphicsContext> &gc, int width, int height);
 
   double GetBootRotation();
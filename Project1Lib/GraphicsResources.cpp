@@ -0,0 +1,108 @@
+/**
+ * @file GraphicsResources.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "GraphicsResources.h"
+
+/// Face of the font all of the game's text is drawn in
+static const wxString FontFace = L"Arial";
+
+/**
+ * Make a key out of a color and another value
+ * @param colour The color
+ * @param value The other value
+ * @return The key
+ */
+static uint64_t MakeKey(const wxColour &colour, uint32_t value)
+{
+  return uint64_t(value) << 32 | uint32_t(colour.GetRGBA());
+}
+
+/**
+ * Empty the cache if the objects were made by another renderer
+ * @param graphics The graphics context that will use the object
+ */
+void GraphicsResources::CheckRenderer(const std::shared_ptr<wxGraphicsContext> &graphics)
+{
+  if (graphics->GetRenderer() != mRenderer)
+  {
+    Clear();
+    mRenderer = graphics->GetRenderer();
+  }
+}
+
+/**
+ * Get a solid pen
+ * @param graphics The graphics context that will draw with the pen
+ * @param colour Color of the pen. wxTransparentColour draws nothing.
+ * @param width Width of the pen in pixels
+ * @return The pen
+ */
+const wxGraphicsPen &GraphicsResources::GetPen(const std::shared_ptr<wxGraphicsContext> &graphics,
+                                               const wxColour &colour, int width)
+{
+  CheckRenderer(graphics);
+
+  auto &pen = mPens[MakeKey(colour, uint32_t(width))];
+  if (pen.IsNull())
+  {
+    pen = graphics->CreatePen(wxPen(colour, width));
+  }
+
+  return pen;
+}
+
+/**
+ * Get a solid brush
+ * @param graphics The graphics context that will fill with the brush
+ * @param colour Color of the brush
+ * @return The brush
+ */
+const wxGraphicsBrush &GraphicsResources::GetBrush(const std::shared_ptr<wxGraphicsContext> &graphics,
+                                                   const wxColour &colour)
+{
+  CheckRenderer(graphics);
+
+  auto &brush = mBrushes[MakeKey(colour, 0)];
+  if (brush.IsNull())
+  {
+    brush = graphics->CreateBrush(wxBrush(colour));
+  }
+
+  return brush;
+}
+
+/**
+ * Get a bold font in the game's face
+ * @param graphics The graphics context that will draw text in the font
+ * @param size Size of the font in pixels
+ * @param colour Color of the text
+ * @return The font
+ */
+const wxGraphicsFont &GraphicsResources::GetFont(const std::shared_ptr<wxGraphicsContext> &graphics, double size,
+                                                 const wxColour &colour)
+{
+  CheckRenderer(graphics);
+
+  // Sizes are kept to a quarter of a pixel
+  auto &font = mFonts[MakeKey(colour, uint32_t(size * 4))];
+  if (font.IsNull())
+  {
+    font = graphics->CreateFont(size, FontFace, wxFONTFLAG_BOLD, colour);
+  }
+
+  return font;
+}
+
+/**
+ * Drop every object in the cache
+ */
+void GraphicsResources::Clear()
+{
+  mPens.clear();
+  mBrushes.clear();
+  mFonts.clear();
+  mRenderer = nullptr;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file GraphicsResources.h
+ * @author Nitish Maindoliya
+ *
+ * Pens, brushes and fonts made once for the graphics renderer.
+ */
+
+#ifndef GRAPHICSRESOURCES_H
+#define GRAPHICSRESOURCES_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * Cache of the renderer's pens, brushes and fonts.
+ *
+ * Setting a wxPen, wxBrush or wxFont on a graphics context makes a
+ * new renderer object every time. The cache makes each one the
+ * first time it is asked for and hands the same one out after
+ * that, so drawing a frame makes none once every item has been
+ * drawn once.
+ *
+ * The game draws with a handful of colors, so nothing is ever
+ * dropped except when a context with a different renderer asks,
+ * since the objects belong to the renderer that made them.
+ */
+class GraphicsResources
+{
+private:
+  /// Renderer the objects were made with
+  wxGraphicsRenderer *mRenderer = nullptr;
+
+  /// Pens by color and width
+  std::unordered_map<uint64_t, wxGraphicsPen> mPens;
+
+  /// Brushes by color
+  std::unordered_map<uint64_t, wxGraphicsBrush> mBrushes;
+
+  /// Fonts by size and color
+  std::unordered_map<uint64_t, wxGraphicsFont> mFonts;
+
+  void CheckRenderer(const std::shared_ptr<wxGraphicsContext> &graphics);
+
+public:
+  /// Constructor
+  GraphicsResources() = default;
+
+  /// Copy constructor (disabled)
+  GraphicsResources(const GraphicsResources &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const GraphicsResources &) = delete;
+
+  const wxGraphicsPen &GetPen(const std::shared_ptr<wxGraphicsContext> &graphics, const wxColour &colour,
+                              int width = 1);
+
+  const wxGraphicsBrush &GetBrush(const std::shared_ptr<wxGraphicsContext> &graphics, const wxColour &colour);
+
+  const wxGraphicsFont &GetFont(const std::shared_ptr<wxGraphicsContext> &graphics, double size,
+                                const wxColour &colour);
+
+  void Clear();
+
+  /**
+   * Get the number of objects in the cache
+   * @return Number of pens, brushes and fonts
+   */
+  size_t GetCount() const { return mPens.size() + mBrushes.size() + mFonts.size(); }
+};
+
+#endif // GRAPHICSRESOURCES_H
@@ -0,0 +1,33 @@
+/**
+ * @file IScoreObserver.h
+ * @author Nitish Maindoliya
+ *
+ */
+
+#ifndef ISCOREOBSERVER_H
+#define ISCOREOBSERVER_H
+
+class Score;
+
+/**
+ * Interface for things that need to know when the score changes
+ */
+class IScoreObserver
+{
+public:
+  /**
+   * The score has changed
+   * @param score The score that changed
+   */
+  virtual void ScoreChanged(Score *score) = 0;
+
+  /**
+   * Destructor
+   */
+  virtual ~IScoreObserver()
+  {
+  }
+
+};
+
+#endif // ISCOREOBSERVER_H
@@ -7,20 +7,12 @@
 #include "pch.h"
 #include "InputPin.h"
 
+#include "Game.h"
 #include "Gate.h"
 
 /// Diameter to draw the pin in pixels
 const int PinSize = 10;
 
-/// Color to use for drawing a zero connection wire
-const wxColour ConnectionColorZero = *wxBLACK;
-
-/// Color to use for drawing a one connection wire
-const wxColour ConnectionColorOne = *wxRED;
-
-/// Color to use for drawing an unknown state connection wire
-const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
-
 /**
  * Constructor
  * @param gate The gate this pin is a member of
@@ -30,6 +22,43 @@ const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
 InputPin::InputPin(Gate *gate, const wxPoint location, InputPinTypes type) :
     mGate(gate), mLocation(location), mType(type)
 {
+  mHandle = gate->GetGame()->GetInputPinSlots().Insert(this);
+}
+
+/**
+ * Destructor
+ */
+InputPin::~InputPin()
+{
+  auto game = mGate->GetGame();
+  game->GetWires().Disconnect(mHandle);
+  game->GetInputPinSlots().Remove(mHandle);
+}
+
+/**
+ * Update the state of the input pin.
+ *
+ * If the output pin we were connected to has been deleted the
+ * wire is dropped and the state is no longer known.
+ */
+void InputPin::Update()
+{
+  auto game = mGate->GetGame();
+  auto driver = game->GetWires().GetDriver(mHandle);
+  if (driver.IsNull())
+  {
+    return;
+  }
+
+  if (auto outputPin = game->GetOutputPinSlots().Get(driver); outputPin != nullptr)
+  {
+    mState = outputPin->GetState();
+  }
+  else
+  {
+    game->GetWires().Disconnect(mHandle);
+    mState = States::Unknown;
+  }
 }
 
 /**
@@ -41,38 +70,46 @@ void InputPin::Draw(const std::shared_ptr<wxGraphicsContext> &gc) const
   const double locationX = mGate->GetX() + mLocation.x;
   const double locationY = mGate->GetY() + mLocation.y;
 
-  wxColour color;
-  switch (mState)
-  {
-  case States::Zero:
-    color = ConnectionColorZero;
-    break;
-  case States::One:
-    color = ConnectionColorOne;
-    break;
-  default:
-    color = ConnectionColorUnknown;
-    break;
-  }
-
+  auto &resources = mGate->GetGame()->GetResources();
+  const auto &colour = WirePath::GetColour(mState);
 
   // Set the pen for drawing
-  gc->SetPen(wxPen(color, LineWidth));
+  gc->SetPen(resources.GetPen(gc, colour, LineWidth));
 
   // Set the brush for drawing
-  gc->SetBrush(wxBrush(color));
+  gc->SetBrush(resources.GetBrush(gc, colour));
 
   // Draw the wire
   gc->StrokeLine(locationX, locationY, locationX + DefaultLineLength, locationY);
 
 
   // Set black pen for drawing the pin's circular borders
-  gc->SetPen(*wxBLACK_PEN);
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
 
   // Draw the pin as a circle
   gc->DrawEllipse(locationX - PinSize / 2.0, locationY - PinSize / 2.0, PinSize, PinSize);
 }
 
+/**
+ * Get the area the pin and the wire into it are drawn in
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect InputPin::GetBounds() const
+{
+  const auto location = GetAbsoluteLocation();
+
+  wxRect bounds(location.x - PinSize / 2, location.y - PinSize / 2, DefaultLineLength + PinSize / 2, PinSize);
+  bounds.Inflate(LineWidth);
+
+  auto game = mGate->GetGame();
+  if (auto outputPin = game->GetOutputPinSlots().Get(game->GetWires().GetDriver(mHandle)); outputPin != nullptr)
+  {
+    bounds.Union(outputPin->GetWireBounds(location));
+  }
+
+  return bounds;
+}
+
 /**
  * Try to catch an input pin at the new x,y location of the rod end
  * @param outputPin Output pin we are trying to catch from
@@ -86,18 +123,45 @@ bool InputPin::Catch(OutputPin *outputPin, wxPoint wireEnd)
 
   if ((relative.x * relative.x + relative.y * relative.y) < PinSize / 2 * PinSize / 2)
   {
-    if (mOutputPin != nullptr)
-    {
-      mOutputPin->RemoveCaught(this);
-    }
-
+    // Connecting replaces any wire we already had
     outputPin->SetCaught(this);
-    mOutputPin = outputPin;
   }
 
   return false;
 }
 
+/**
+ * Is a location on the wire into this pin?
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return True if there is a wire into the pin and the location is on it
+ */
+bool InputPin::HitTestWire(int x, int y)
+{
+  auto game = mGate->GetGame();
+  auto outputPin = game->GetOutputPinSlots().Get(game->GetWires().GetDriver(mHandle));
+  if (outputPin == nullptr)
+  {
+    return false;
+  }
+
+  // The gates may have moved since the wire was last drawn
+  mWire.SetEnds(outputPin->GetAbsoluteLocation(), GetAbsoluteLocation());
+  return mWire.HitTest(x, y);
+}
+
+/**
+ * Remove the wire into this pin
+ */
+void InputPin::Disconnect()
+{
+  auto game = mGate->GetGame();
+  game->Damage(GetBounds());
+
+  game->GetWires().Disconnect(mHandle);
+  mState = States::Unknown;
+}
+
 /**
  * Get the location of the InputPin in pixels, not relative to the gate
  * @return Location in pixels
@@ -116,7 +180,11 @@ wxPoint InputPin::GetAbsoluteLocation() const
  */
 void InputPin::SetInputLine(OutputPin *outputPin)
 {
-  mOutputPin = outputPin;
+  // The wire being replaced goes away
+  auto game = mGate->GetGame();
+  game->Damage(GetBounds());
+
+  game->GetWires().Connect(outputPin->GetHandle(), mHandle);
 
   mState = outputPin->GetState();
 }
@@ -11,6 +11,7 @@
 
 #include "States.h"
 #include "OutputPin.h"
+#include "SlotTable.h"
 
 
 class Gate;
@@ -33,8 +34,11 @@ private:
   /// Type of the pin
   InputPinTypes mType;
 
-  /// Output pin we are connected to
-  OutputPin *mOutputPin = nullptr;
+  /// Handle of this pin in the game
+  Handle mHandle;
+
+  /// The curve of the wire into this pin
+  WirePath mWire;
 
 public:
   /// Default constructor (disabled)
@@ -49,22 +53,29 @@ public:
   /// Constructor
   InputPin(Gate *gate, wxPoint location, InputPinTypes type = InputPinTypes::Regular);
 
+  /// Destructor
+  ~InputPin();
+
   //// Draw the input pin
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) const;
 
-  /**
-   * Update the state of the input pin
-   */
-  void Update()
-  {
-    if (mOutputPin)
-    {
-      mState = mOutputPin->GetState();
-    }
-  }
+  void Update();
+
+  wxRect GetBounds() const;
 
   bool Catch(OutputPin *outputPin, wxPoint wireEnd);
 
+  bool HitTestWire(int x, int y);
+
+  void Disconnect();
+
+  /**
+   * Get the curve of the wire into this pin. The output pin
+   * driving it keeps the ends up to date when it draws it.
+   * @return The wire
+   */
+  WirePath &GetWire() { return mWire; }
+
   /**
    * Get the absolute location of the input pin
    * @return The absolute location of the input pin
@@ -84,6 +95,12 @@ public:
    */
   void SetInputLine(OutputPin *outputPin);
 
+  /**
+   * Get the handle of this pin in the game
+   * @return Handle
+   */
+  Handle GetHandle() const { return mHandle; }
+
   /**
    * Get the state of the input pin
    * @return The state of the input pin
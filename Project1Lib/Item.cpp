@@ -5,13 +5,15 @@
 
 #include "pch.h"
 #include "Item.h"
+#include "Game.h"
 
 /**
  * Constructor
  * @param game The game this item is a member of
+ * @param type The kind of item
  */
-Item::Item(Game *game) :
-  mGame(game)
+Item::Item(Game *game, ItemType type) :
+  mGame(game), mType(type)
 {
 }
 
@@ -28,6 +30,34 @@ void Item::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
 }
 
+/**
+ * Get the area the item draws in.
+ *
+ * This is the base class version, which is the whole playing
+ * area. Items that know where they draw override it so they are
+ * only drawn again when something near them changes.
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Item::GetBounds() { return mGame->GetArea(); }
+
+/**
+ * Set the location of the item
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ */
+void Item::SetLocation(double x, double y)
+{
+  mGame->Damage(GetBounds());
+  mX = x;
+  mY = y;
+  mGame->Damage(GetBounds());
+
+  if (HasStaticPart())
+  {
+    mGame->InvalidateStatic();
+  }
+}
+
 /**
  * Load the attributes for an item node.
  *
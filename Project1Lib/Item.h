@@ -7,19 +7,24 @@
 #ifndef ITEM_H
 #define ITEM_H
 
+#include <memory>
+
 #include "Visitors/ItemVisitor.h"
 #include "IDraggable.h"
+#include "ItemType.h"
+#include "SlotTable.h"
 
 
 class OutputPin;
 class Game;
+class ProductionLine;
 
 class wxXmlNode;
 
 /**
  * Class that implements an Item
  */
-class Item : public IDraggable
+class Item : public IDraggable, public std::enable_shared_from_this<Item>
 {
 private:
   /// The game this item is contained in.
@@ -28,9 +33,15 @@ private:
   double mX = 0;
   /// The y-coordinate of the center of the item.
   double mY = 0;
+  /// The production line this item belongs to, or nullptr if none
+  ProductionLine *mLine = nullptr;
+  /// The kind of item this is
+  const ItemType mType;
+  /// Handle of this item in the game, null if not in the game
+  Handle mHandle;
 
 protected:
-  Item(Game *game);
+  Item(Game *game, ItemType type);
 
 public:
   /// Default constructor (disabled)
@@ -51,11 +62,31 @@ public:
   */
   virtual void Accept(ItemVisitor *visitor) = 0;
 
+  /**
+   * Get the kind of item this is.
+   *
+   * Used to visit items without a virtual call.
+   * @return Item type
+   */
+  ItemType GetType() const { return mType; }
+
+  /**
+   * Get the handle of this item in the game
+   * @return Handle, null if the item is not in the game
+   */
+  Handle GetHandle() const { return mHandle; }
+
+  /**
+   * Set the handle of this item in the game
+   * @param handle The handle
+   */
+  void SetHandle(Handle handle) { mHandle = handle; }
+
   /**
    * Getter for the x coordinate
    * @return
    */
-  double GetX() const { return mX; };
+  virtual double GetX() const { return mX; };
 
   /**
    * Setter for the x coordinate
@@ -67,7 +98,7 @@ public:
    * Getter for the y coordinate
    * @return
    */
-  double GetY() const { return mY; };
+  virtual double GetY() const { return mY; };
 
   /**
    * Setter for the y coordinate
@@ -81,8 +112,38 @@ public:
    */
   Game *GetGame() const { return mGame; }
 
+  /**
+   * Get the production line this item belongs to
+   * @return Production line or nullptr if none
+   */
+  ProductionLine *GetLine() const { return mLine; }
+
+  /**
+   * Set the production line this item belongs to
+   * @param line The production line
+   */
+  void SetLine(ProductionLine *line) { mLine = line; }
+
   virtual void Draw(const std::shared_ptr<wxGraphicsContext> &gc);
 
+  /**
+   * Draw the parts of the item that rarely change.
+   *
+   * These are drawn once into the game's static layer, under
+   * everything Draw draws, and drawn again only when the layer
+   * is invalidated.
+   * @param gc The graphics context to draw on
+   */
+  virtual void DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc) {}
+
+  /**
+   * Does this item draw anything in the static layer?
+   * @return True if DrawStatic draws something
+   */
+  virtual bool HasStaticPart() const { return false; }
+
+  virtual wxRect GetBounds();
+
   /**
    * Test to see if we clicked on some draggable inside the item.
    * @param x X location clicked on
@@ -123,11 +184,7 @@ public:
    * @param x X location in pixels
    * @param y Y location in pixels
    */
-  void SetLocation(double x, double y) override
-  {
-    mX = x;
-    mY = y;
-  }
+  void SetLocation(double x, double y) override;
 
   /**
    * Move this item to the front
@@ -0,0 +1,299 @@
+/**
+ * @file ItemRegistry.h
+ * @author Nitish Maindoliya
+ *
+ * The kinds of items that can be created by name, declared once
+ * and turned into lookup tables at compile time.
+ */
+
+#ifndef ITEMREGISTRY_H
+#define ITEMREGISTRY_H
+
+#include "Game.h"
+#include "PerfectHash.h"
+#include "Items/Conveyor.h"
+#include "Items/Scoreboard.h"
+#include "Items/Sensor.h"
+#include "Gates/ANDGate.h"
+#include "Gates/Beam.h"
+#include "Gates/DFlipFlop.h"
+#include "Gates/NOTGate.h"
+#include "Gates/ORGate.h"
+#include "Gates/Sparty.h"
+#include "Gates/SRFlipFlop.h"
+
+#include <array>
+#include <memory>
+#include <string_view>
+
+/**
+ * A list of types
+ * @tparam Types The types
+ */
+template <class... Types>
+struct TypeList
+{
+};
+
+/**
+ * What the registry needs to know about one kind of item.
+ *
+ * Each kind of item that can be created by name specializes this.
+ * Level items give their XML tag and menu gates their menu text.
+ * @tparam T The item class
+ */
+template <class T>
+struct ItemInfo;
+
+/**
+ * Defaults for ItemInfo, which a specialization can hide
+ * @tparam T The item class
+ */
+template <class T>
+struct ItemInfoDefaults
+{
+  /**
+   * Create the item in the level arena
+   * @param game The game the item is in
+   * @return The new item
+   */
+  static std::shared_ptr<T> Create(Game *game) { return game->GetArena().Make<T>(game); }
+
+  /**
+   * Tell the production line about the item
+   * @param line The line the item is loaded into
+   * @param item The item
+   */
+  static void AddToLine(ProductionLine *line, T *item) {}
+};
+
+/// The conveyor of a production line
+template <>
+struct ItemInfo<Conveyor> : ItemInfoDefaults<Conveyor>
+{
+  /// XML tag in a level file
+  static constexpr std::wstring_view Tag = L"conveyor";
+
+  /**
+   * Tell the production line about the conveyor
+   * @param line The line
+   * @param conveyor The conveyor
+   */
+  static void AddToLine(ProductionLine *line, Conveyor *conveyor) { line->SetConveyor(conveyor); }
+};
+
+/// The sensor of a production line
+template <>
+struct ItemInfo<Sensor> : ItemInfoDefaults<Sensor>
+{
+  /// XML tag in a level file
+  static constexpr std::wstring_view Tag = L"sensor";
+
+  /**
+   * Tell the production line about the sensor
+   * @param line The line
+   * @param sensor The sensor
+   */
+  static void AddToLine(ProductionLine *line, Sensor *sensor) { line->SetSensor(sensor); }
+};
+
+/// The beam of a production line
+template <>
+struct ItemInfo<Beam> : ItemInfoDefaults<Beam>
+{
+  /// XML tag in a level file
+  static constexpr std::wstring_view Tag = L"beam";
+
+  /**
+   * Tell the production line about the beam
+   * @param line The line
+   * @param beam The beam
+   */
+  static void AddToLine(ProductionLine *line, Beam *beam) { line->SetBeam(beam); }
+};
+
+/// Sparty, who kicks products off a production line
+template <>
+struct ItemInfo<Sparty> : ItemInfoDefaults<Sparty>
+{
+  /// XML tag in a level file
+  static constexpr std::wstring_view Tag = L"sparty";
+
+  /**
+   * Tell the production line about Sparty
+   * @param line The line
+   * @param sparty Sparty
+   */
+  static void AddToLine(ProductionLine *line, Sparty *sparty) { line->SetSparty(sparty); }
+};
+
+/// The scoreboard
+template <>
+struct ItemInfo<Scoreboard> : ItemInfoDefaults<Scoreboard>
+{
+  /// XML tag in a level file
+  static constexpr std::wstring_view Tag = L"scoreboard";
+
+  /**
+   * Create the scoreboard for the game's score
+   * @param game The game
+   * @return The new scoreboard
+   */
+  static std::shared_ptr<Scoreboard> Create(Game *game)
+  {
+    return game->GetArena().Make<Scoreboard>(game, game->GetScore());
+  }
+};
+
+/// AND gate
+template <>
+struct ItemInfo<ANDGate> : ItemInfoDefaults<ANDGate>
+{
+  /// Text for the Gates menu
+  static constexpr const wchar_t *MenuText = L"&AND";
+  /// Help for the Gates menu
+  static constexpr const wchar_t *MenuHelp = L"Add an AND Gate";
+};
+
+/// OR gate
+template <>
+struct ItemInfo<ORGate> : ItemInfoDefaults<ORGate>
+{
+  /// Text for the Gates menu
+  static constexpr const wchar_t *MenuText = L"&OR";
+  /// Help for the Gates menu
+  static constexpr const wchar_t *MenuHelp = L"Add an OR Gate";
+};
+
+/// NOT gate
+template <>
+struct ItemInfo<NOTGate> : ItemInfoDefaults<NOTGate>
+{
+  /// Text for the Gates menu
+  static constexpr const wchar_t *MenuText = L"&NOT";
+  /// Help for the Gates menu
+  static constexpr const wchar_t *MenuHelp = L"Add a NOT Gate";
+};
+
+/// SR flip flop
+template <>
+struct ItemInfo<SRFlipFlop> : ItemInfoDefaults<SRFlipFlop>
+{
+  /// Text for the Gates menu
+  static constexpr const wchar_t *MenuText = L"&SR Flip Flop";
+  /// Help for the Gates menu
+  static constexpr const wchar_t *MenuHelp = L"Add an SR Flip Flop Gate";
+};
+
+/// D flip flop
+template <>
+struct ItemInfo<DFlipFlop> : ItemInfoDefaults<DFlipFlop>
+{
+  /// Text for the Gates menu
+  static constexpr const wchar_t *MenuText = L"&D Flip Flop";
+  /// Help for the Gates menu
+  static constexpr const wchar_t *MenuHelp = L"Add a D Flip Flop Gate";
+};
+
+/// The items that have their own tag in a level file
+using LevelItemTypes = TypeList<Sensor, Conveyor, Beam, Sparty, Scoreboard>;
+
+/// The gates on the Gates menu, in menu order
+using MenuGateTypes = TypeList<ANDGate, ORGate, NOTGate, SRFlipFlop, DFlipFlop>;
+
+template <class List>
+class LevelItemRegistry;
+
+/**
+ * Creates level items from their XML tags
+ * @tparam Types The level item classes
+ */
+template <class... Types>
+class LevelItemRegistry<TypeList<Types...>>
+{
+private:
+  /// Function that creates an item and adds it to a line
+  using Factory = std::shared_ptr<Item> (*)(Game *, ProductionLine *);
+
+  /**
+   * Create an item and add it to a line
+   * @tparam T The item class
+   * @param game The game
+   * @param line The line the item is loaded into
+   * @return The new item
+   */
+  template <class T>
+  static std::shared_ptr<Item> Make(Game *game, ProductionLine *line)
+  {
+    auto item = ItemInfo<T>::Create(game);
+    ItemInfo<T>::AddToLine(line, item.get());
+    return item;
+  }
+
+  /// Table for finding a kind of item from its tag
+  static constexpr PerfectHash<sizeof...(Types)> Tags{std::array<std::wstring_view, sizeof...(Types)>{
+    ItemInfo<Types>::Tag...}};
+
+  /// Factory for each kind of item, in the same order as the tags
+  static constexpr std::array<Factory, sizeof...(Types)> Factories = {&Make<Types>...};
+
+public:
+  /**
+   * Create an item from its tag
+   * @param tag The XML tag
+   * @param game The game
+   * @param line The line the item is loaded into
+   * @return The new item, or nullptr if no item has that tag
+   */
+  static std::shared_ptr<Item> Create(std::wstring_view tag, Game *game, ProductionLine *line)
+  {
+    const int index = Tags.Find(tag);
+    return index < 0 ? nullptr : Factories[size_t(index)](game, line);
+  }
+};
+
+/**
+ * An entry on the Gates menu
+ */
+struct GateMenuEntry
+{
+  /// Menu text
+  const wchar_t *mText;
+
+  /// Menu help
+  const wchar_t *mHelp;
+
+  /// Function that creates the gate
+  std::shared_ptr<Gate> (*mCreate)(Game *);
+};
+
+template <class List>
+class GateMenu;
+
+/**
+ * The entries on the Gates menu
+ * @tparam Types The gate classes, in menu order
+ */
+template <class... Types>
+class GateMenu<TypeList<Types...>>
+{
+private:
+  /**
+   * Create a gate
+   * @tparam T The gate class
+   * @param game The game
+   * @return The new gate
+   */
+  template <class T>
+  static std::shared_ptr<Gate> Make(Game *game)
+  {
+    return ItemInfo<T>::Create(game);
+  }
+
+public:
+  /// The menu entries
+  static constexpr std::array<GateMenuEntry, sizeof...(Types)> Entries = {
+    GateMenuEntry{ItemInfo<Types>::MenuText, ItemInfo<Types>::MenuHelp, &Make<Types>}...};
+};
+
+#endif // ITEMREGISTRY_H
@@ -0,0 +1,32 @@
+/**
+ * @file ItemType.h
+ * @author Nitish Maindoliya
+ *
+ */
+
+#ifndef ITEMTYPE_H
+#define ITEMTYPE_H
+
+/**
+ * The kinds of items in the game. There is one for each
+ * class of item that can be created.
+ */
+enum class ItemType
+{
+  Badge,
+  Conveyor,
+  LevelNotice,
+  Product,
+  Scoreboard,
+  Sensor,
+  ANDGate,
+  Beam,
+  DFlipFlop,
+  NOTGate,
+  ORGate,
+  SensorGate,
+  Sparty,
+  SRFlipFlop
+};
+
+#endif // ITEMTYPE_H
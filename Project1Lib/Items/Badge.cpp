@@ -9,6 +9,8 @@
 #include "../Game.h"
 #include "../Score.h"
 
+#include <iterator>
+
 /// The location of the badge in virtual pixels.
 /// @return wxPoint The location of the badge
 const wxPoint Location(950, 150);
@@ -34,19 +36,32 @@ static constexpr int BooleanWarriorScore = 60;
 /// Score needed to earn badge Spartan Genius
 static constexpr int SpartanGeniusScore = 100;
 
+/// Score needed for each badge, in the order of Badges
+static constexpr int BadgeScores[] = {0, LogicRookieScore, BooleanWarriorScore, SpartanGeniusScore};
+
+/// The highest badge that can be earned
+static constexpr int TopBadge = int(std::size(BadgeScores)) - 1;
+
 /**
  * Constructor
  * @param game The game this Badge is a member of
  */
 Badge::Badge(Game *game) :
-  Item(game)
+  Item(game, ItemType::Badge)
 {
-  // Set badge to Logic Rookie on initialization
-  mBadge = Badges::LogicRookie;
-  mCurrentBadgeImage = nullptr;
-
   SetX(Location.x);
   SetY(Location.y);
+
+  GetGame()->GetScore()->AddObserver(this);
+  ScoreChanged(GetGame()->GetScore());
+}
+
+/**
+ * Destructor
+ */
+Badge::~Badge()
+{
+  GetGame()->GetScore()->RemoveObserver(this);
 }
 
 /**
@@ -57,55 +72,73 @@ void Badge::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
   if (mCurrentBadgeImage != nullptr)
   {
-    gc->DrawBitmap(*mCurrentBadgeImage, GetX(), GetY(), mCurrentBadgeImage->GetWidth() / Scale,
-                   mCurrentBadgeImage->GetHeight() / Scale);
+    const double width = mCurrentBadgeImage->GetWidth() / Scale;
+    const double height = mCurrentBadgeImage->GetHeight() / Scale;
+    gc->DrawBitmap(GetGame()->GetSprite(gc, *mCurrentBadgeImage, width, height), GetX(), GetY(), width, height);
   }
 }
 
 /**
- * Update the badge
- * @param elapsed The time since the last update
+ * Get the area the badge is drawn in
+ * @return Bounding rectangle in virtual pixels, empty if there is no badge
  */
-void Badge::Update(double elapsed)
+wxRect Badge::GetBounds()
 {
-  switch (mBadge)
+  if (mCurrentBadgeImage == nullptr)
   {
-  case Badges::LogicRookie:
-    mCurrentBadgeImage = GetGame()->GetImage(LogicRookieBadgeImage);
-    break;
-  case Badges::BooleanWarrior:
-    mCurrentBadgeImage = GetGame()->GetImage(BooleanWarriorBadgeImage);
-    break;
-  case Badges::SpartanGenius:
-    mCurrentBadgeImage = GetGame()->GetImage(SpartanGeniusBadgeImage);
-    break;
-  default:
-    mCurrentBadgeImage = nullptr;
-    break;
+    return wxRect();
   }
+
+  return wxRect(GetX(), GetY(), mCurrentBadgeImage->GetWidth() / Scale + 1,
+                mCurrentBadgeImage->GetHeight() / Scale + 1);
 }
 
 /**
- * Update the badge based on the score
+ * Update the badge when the score changes.
+ *
+ * The score only moves a few points at a time, so we step up or
+ * down from the badge we already have instead of testing them all.
  * @param score The score object
  */
-void Badge::UpdateBadge(Score *score)
+void Badge::ScoreChanged(Score *score)
 {
-  const double scoreValue = score->GetLevelScore() + score->GetGameScore();
-  if (scoreValue >= SpartanGeniusScore)
+  const int scoreValue = score->GetLevelScore() + score->GetGameScore();
+  const auto oldBadge = mBadge;
+
+  int badge = int(mBadge);
+  while (badge < TopBadge && scoreValue >= BadgeScores[badge + 1])
   {
-    mBadge = Badges::SpartanGenius;
+    badge++;
   }
-  else if (scoreValue >= BooleanWarriorScore)
+
+  while (badge > 0 && scoreValue < BadgeScores[badge])
   {
-    mBadge = Badges::BooleanWarrior;
+    badge--;
   }
-  else if (scoreValue >= LogicRookieScore)
+
+  mBadge = Badges(badge);
+  if (mBadge == oldBadge && mCurrentBadgeImage != nullptr)
   {
-    mBadge = Badges::LogicRookie;
+    return;
   }
-  else
+
+  GetGame()->Damage(GetBounds());
+
+  switch (mBadge)
   {
-    mBadge = Badges::NoneEarned;
+  case Badges::LogicRookie:
+    mCurrentBadgeImage = GetGame()->GetImage(LogicRookieBadgeImage);
+    break;
+  case Badges::BooleanWarrior:
+    mCurrentBadgeImage = GetGame()->GetImage(BooleanWarriorBadgeImage);
+    break;
+  case Badges::SpartanGenius:
+    mCurrentBadgeImage = GetGame()->GetImage(SpartanGeniusBadgeImage);
+    break;
+  default:
+    mCurrentBadgeImage = nullptr;
+    break;
   }
+
+  GetGame()->Damage(GetBounds());
 }
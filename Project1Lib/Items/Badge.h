@@ -9,12 +9,13 @@
 #define BADGE_H
 
 #include "../Item.h"
+#include "../IScoreObserver.h"
 
 class Score;
 /**
  * Class that implements a Badge
  */
-class Badge : public Item
+class Badge : public Item, public IScoreObserver
 {
 private:
   /// The underlying image that corresponds with the current badge achieved
@@ -24,13 +25,13 @@ private:
   std::unique_ptr<wxBitmap> mCurrentBadgeBitmap;
 
 
-  /// The type of badge the user has earned
+  /// The type of badge the user has earned, lowest first
   enum class Badges
   {
+    NoneEarned,
     LogicRookie,
     BooleanWarrior,
-    SpartanGenius,
-    NoneEarned
+    SpartanGenius
   };
 
   /// The badge the user has earned
@@ -48,6 +49,8 @@ public:
 
   Badge(Game *game);
 
+  ~Badge() override;
+
   /**
    * Accept a visitor
    * @param visitor The visitor we accept
@@ -62,17 +65,9 @@ public:
    */
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
- /**
-   * Update the badge based on the score
-   * @param score The score object
-   */
-  void UpdateBadge(Score *score);
+  wxRect GetBounds() override;
 
-  /**
-   * Update the badge
-   * @param elapsed The time since the last update
-   */
-  void Update(double elapsed) override;
+  void ScoreChanged(Score *score) override;
 };
 
 
@@ -9,8 +9,10 @@
 
 #include "../Game.h"
 #include "Product.h"
-#include "../Visitors/ProductAnimator.h"
-#include "../Visitors/ZeroScoreVisitor.h"
+#include "../Gates/Beam.h"
+#include "../Gates/SensorGate.h"
+#include "../ProductionLine.h"
+#include "../Sources/ProductSource.h"
 
 #include <sstream>
 
@@ -35,12 +37,15 @@ const wxRect StartButtonRect(35, 29, 95, 36);
 /// @return wxRect The rectangle defining the stop button's location
 const wxRect StopButtonRect(35, 87, 95, 36);
 
+/// Room around the belt for the products on it in pixels
+const int ProductMargin = 40;
+
 
 /**
  * Constructor
  * @param game the game that the conveyor is a part of
  */
-Conveyor::Conveyor(Game *game) : Item(game)
+Conveyor::Conveyor(Game *game) : Item(game, ItemType::Conveyor)
 {
     mConveyorBackgroundImage = GetGame()->GetImage(ConveyorBackgroundImage);
     mConveyorBeltImage = GetGame()->GetImage(ConveyorBeltImage);
@@ -49,40 +54,92 @@ Conveyor::Conveyor(Game *game) : Item(game)
 }
 
 /**
- * Draw the conveyor
+ * Draw the frame of the conveyor
  * @param gc The graphics context to draw on
  */
-void Conveyor::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+void Conveyor::DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc)
 {
     const double height = mHeight;
     const double width = mConveyorBackgroundImage->GetWidth() * height / mConveyorBackgroundImage->GetHeight();
 
     // Draw conveyor background image
-    gc->DrawBitmap(*mConveyorBackgroundImage, GetX() - width / 2, GetY() - height / 2, width, height);
+    gc->DrawBitmap(GetGame()->GetSprite(gc, *mConveyorBackgroundImage, width, height), GetX() - width / 2,
+                   GetY() - height / 2, width, height);
+}
+
+/**
+ * Draw the moving belt and the panel
+ * @param gc The graphics context to draw on
+ */
+void Conveyor::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+{
+    const double height = mHeight;
+    const double width = mConveyorBackgroundImage->GetWidth() * height / mConveyorBackgroundImage->GetHeight();
 
     // Calculate the Y position of the first conveyor image, wrapping it using modulo
-    double conveyorY = fmod(mBeltY, height);
+    double conveyorY = fmod(mSpeed * mTime, height);
 
     // Draw the first conveyor image
-    gc->DrawBitmap(*mConveyorBeltImage, GetX() - width / 2, conveyorY - height, width, height);
+    const auto &belt = GetGame()->GetSprite(gc, *mConveyorBeltImage, width, height);
+    gc->DrawBitmap(belt, GetX() - width / 2, conveyorY - height, width, height);
 
     // Draw the second conveyor image within the game area for seamless looping
-    gc->DrawBitmap(*mConveyorBeltImage, GetX() - width / 2, conveyorY, width, height);
+    gc->DrawBitmap(belt, GetX() - width / 2, conveyorY, width, height);
 
     // Draw Conveyor Panel (Started is conveyor is running, Stopped otherwise)
     if (mIsRunning)
     {
-        gc->DrawBitmap(*mConveyorPanelStartedImage, GetX() + mPanelX, GetY() + mPanelY,
-                       mConveyorPanelStartedImage->GetWidth(), mConveyorPanelStartedImage->GetHeight());
+        const double panelWidth = mConveyorPanelStartedImage->GetWidth();
+        const double panelHeight = mConveyorPanelStartedImage->GetHeight();
+        gc->DrawBitmap(GetGame()->GetSprite(gc, *mConveyorPanelStartedImage, panelWidth, panelHeight),
+                       GetX() + mPanelX, GetY() + mPanelY, panelWidth, panelHeight);
     }
     else
     {
-        gc->DrawBitmap(*mConveyorPanelStoppedImage, GetX() + mPanelX, GetY() + mPanelY,
-                       mConveyorPanelStartedImage->GetWidth(), mConveyorPanelStartedImage->GetHeight());
+        const double panelWidth = mConveyorPanelStartedImage->GetWidth();
+        const double panelHeight = mConveyorPanelStartedImage->GetHeight();
+        gc->DrawBitmap(GetGame()->GetSprite(gc, *mConveyorPanelStoppedImage, panelWidth, panelHeight),
+                       GetX() + mPanelX, GetY() + mPanelY, panelWidth, panelHeight);
     }
 }
 
 
+/**
+ * Get the area the conveyor and its products are drawn in.
+ *
+ * Products are on the belt until they are kicked, then they
+ * move off the left side, so the area goes to the left edge.
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Conveyor::GetBounds()
+{
+    const int height = mHeight;
+    const int width = mConveyorBackgroundImage->GetWidth() * height / mConveyorBackgroundImage->GetHeight();
+
+    wxRect bounds(0, GetY() - height / 2, GetX() + width / 2, height);
+    bounds.Inflate(ProductMargin);
+
+    bounds.Union(wxRect(GetX() + mPanelX, GetY() + mPanelY, mConveyorPanelStartedImage->GetWidth(),
+                        mConveyorPanelStartedImage->GetHeight()));
+    return bounds;
+}
+
+/**
+ * Handle updates for animation.
+ *
+ * The belt and its products move every tick while the conveyor
+ * runs, and kicked products move until they are off the screen,
+ * so it is drawn again every tick while either is happening.
+ * @param elapsed The time since the last update
+ */
+void Conveyor::Update(double elapsed)
+{
+    if (mIsRunning || !mKickCalendar.IsEmpty())
+    {
+        GetGame()->Damage(GetBounds());
+    }
+}
+
 /**
  * Load the attributes specific for a conveyor node.
  * @param node The Xml node we are loading the item from
@@ -91,6 +148,148 @@ void Conveyor::XmlLoad(wxXmlNode *node)
 {
     XmlLoader loader(GetGame());
     loader.LoadConveyor(this, node);
+
+    Restart();
+}
+
+/**
+ * Set where the products on this conveyor come from
+ * @param source The product source
+ */
+void Conveyor::SetSource(std::unique_ptr<ProductSource> source)
+{
+    mSource = std::move(source);
+}
+
+/**
+ * Accept a visitor for the conveyor and the products on it
+ * @param visitor The visitor we accept
+ */
+void Conveyor::Accept(ItemVisitor *visitor)
+{
+    visitor->VisitConveyor(this);
+
+    for (const auto &product : mProducts)
+    {
+        product->Accept(visitor);
+    }
+}
+
+/**
+ * Draw the products on the conveyor
+ * @param gc The graphics context to draw on
+ */
+void Conveyor::DrawProducts(const std::shared_ptr<wxGraphicsContext> &gc)
+{
+    for (const auto &product : mProducts)
+    {
+        product->Draw(gc);
+    }
+}
+
+/**
+ * Get the beam on this conveyor's line
+ * @return Beam or nullptr if there is none
+ */
+Beam *Conveyor::GetBeam() const
+{
+    return GetLine() != nullptr ? GetLine()->GetBeam() : nullptr;
+}
+
+/**
+ * Kick a product off of the belt
+ * @param product The product to kick
+ */
+void Conveyor::KickProduct(Product *product)
+{
+    product->Kick(mTime, mKickClock);
+    mProductIndex.Remove(product);
+
+    // A kicked product stops moving down, so none of its
+    // scheduled crossings will happen. It leaves the beam
+    // and the sensor window right now instead.
+    mCalendar.Cancel(product);
+
+    auto sensed = std::find(mSensorProducts.begin(), mSensorProducts.end(), product);
+    if (sensed != mSensorProducts.end())
+    {
+        mSensorProducts.erase(sensed);
+    }
+
+    if (auto beam = GetBeam(); beam != nullptr)
+    {
+        beam->ProductLeft(product);
+    }
+
+    // A product kicked before it reached the beam is never scored
+    ResolveProduct(product, false);
+
+    // It goes off the left side once it has moved twice our X,
+    // whether or not the belt is still running by then
+    mKickCalendar.Schedule(mKickClock + 2 * GetX() / Product::MovingLeftSpeed, EventCalendar::EventType::OffScreen,
+                           product);
+}
+
+/**
+ * Schedule a kick of whatever is in the beam.
+ *
+ * The kick happens when the boot reaches the belt, which is at
+ * an exact conveyor time no matter how long the frames are.
+ * @param delay Time from now until the boot reaches the belt
+ */
+void Conveyor::ScheduleKick(double delay)
+{
+    if (!mIsRunning)
+    {
+        // The belt does not move while stopped, so kick right away
+        KickBeamProducts();
+        return;
+    }
+
+    mCalendar.Schedule(mTime + delay, EventCalendar::EventType::Kick, nullptr);
+}
+
+/**
+ * Resolve a product, taking it out of the count of products in flight.
+ *
+ * Resolving a product that is already resolved does nothing.
+ * @param product The product
+ * @param scored True if the product left the beam and is scored
+ */
+void Conveyor::ResolveProduct(Product *product, bool scored)
+{
+    if (product->IsResolved())
+    {
+        return;
+    }
+
+    product->SetResolved();
+    mInFlight[product->ShouldKick()]--;
+
+    if (scored && GetLine() != nullptr)
+    {
+        GetLine()->ProductScored(product->ShouldKick() == product->IsMovingLeft());
+    }
+}
+
+/**
+ * Kick every product that is in the beam right now
+ */
+void Conveyor::KickBeamProducts()
+{
+    auto beam = GetBeam();
+    if (beam == nullptr)
+    {
+        return;
+    }
+
+    // Kicking takes the products off the belt, so copy the range first
+    auto range = mProductIndex.Query(beam->GetY() - BeamYTolerance, beam->GetY() + BeamYTolerance);
+    std::vector<Product *> products(range.begin(), range.end());
+    for (auto product : products)
+    {
+        KickProduct(product);
+    }
 }
 
 
@@ -101,22 +300,16 @@ void Conveyor::XmlLoad(wxXmlNode *node)
  */
 void Conveyor::Start()
 {
-    mBeltY = 0;
     mIsRunning = true;
+    mHasStarted = true;
+    GetGame()->Damage(GetBounds());
 
-    ZeroScoreVisitor zeroScoreVisitor;
-    GetGame()->Accept(&zeroScoreVisitor);
-
-    // Reset all products using visitor
-    ProductAnimator animator(this, 0, GetGame()->GetHeight(), true);
-
-    auto items = GetGame()->GetItems();
-    for (auto item : items)
+    if (GetLine() != nullptr)
     {
-      item->Accept(&animator);
+        GetLine()->Reset();
     }
 
-
+    Restart();
 }
 
 /**
@@ -126,27 +319,277 @@ void Conveyor::Start()
 void Conveyor::Stop()
 {
     mIsRunning = false;
+    GetGame()->Damage(GetBounds());
 }
 
 
 /**
- * Handle updates for animation
+ * Move the belt and its products forward in time.
+ *
+ * This is called by the conveyor's production line rather than
+ * as an item update, so the lines can move before everything
+ * else reacts to them. Kicked products keep moving off the belt
+ * while it is stopped.
  * @param elapsed The time since the last update
  */
-void Conveyor::Update(double elapsed)
+void Conveyor::Advance(double elapsed)
 {
+    const double kickClockStart = mKickClock;
+    EventCalendar::Event event;
+
     if (mIsRunning)
     {
-        // Update belt animation
-        mBeltY += elapsed * mSpeed;
-        if (mBeltY >= mHeight)
+        const double startTime = mTime;
+        const double endTime = mTime + elapsed;
+
+        // Bring on the products that come into view during this step
+        EmitProducts(endTime);
+
+        // Fire every event up to the end of this step at its exact time.
+        // The kick clock keeps pace so products kicked now move from here.
+        while (mCalendar.PopNext(endTime, event))
         {
-            mBeltY = fmod(mBeltY, mHeight);
+            mTime = std::max(mTime, event.mTime);
+            mKickClock = kickClockStart + mTime - startTime;
+            HandleEvent(event);
         }
 
-        // Create animator and apply to all items
-        ProductAnimator animator(this, elapsed, GetGame()->GetHeight());
-        GetGame()->Accept(&animator);
+        // The belt and every product on it are positioned from this time
+        mTime = endTime;
+    }
+
+    // Kicked products are positioned from the kick clock
+    mKickClock = kickClockStart + elapsed;
+    while (mKickCalendar.PopNext(mKickClock, event))
+    {
+        HandleEvent(event);
+    }
+}
+
+/**
+ * Put the conveyor back to time zero with the first
+ * products from the source on the belt.
+ */
+void Conveyor::Restart()
+{
+    mTime = 0;
+    mKickClock = 0;
+
+    while (!mProducts.empty())
+    {
+        Recycle(mProducts.back().get());
+    }
+
+    mProductIndex.Clear();
+    mCalendar.Clear();
+    mKickCalendar.Clear();
+    mSensorProducts.clear();
+
+    if (auto beam = GetBeam(); beam != nullptr)
+    {
+        beam->Reset();
+    }
+
+    mHasNextProduct = false;
+    if (mSource != nullptr)
+    {
+        mSource->Rewind();
+        mHasNextProduct = mSource->Next(mNextProduct);
+    }
+
+    EmitProducts(0);
+}
+
+/**
+ * Put the products that are in view at a time onto the belt.
+ *
+ * A product comes on once it is within one conveyor height of
+ * the top of the game, so it is on the belt well before it can
+ * be seen or reach the beam.
+ * @param time Conveyor time
+ */
+void Conveyor::EmitProducts(double time)
+{
+    mEmitted.clear();
+    while (mHasNextProduct && GetY() - mNextProduct.mPlacement + mSpeed * time > -mHeight)
+    {
+        const auto &spec = mNextProduct;
+
+        std::shared_ptr<Product> product;
+        if (mFreeProducts.empty())
+        {
+            product = std::make_shared<Product>(GetGame(), &mPool, spec.mPlacement, spec.mShape, spec.mColor,
+                                                spec.mContent, spec.mKick);
+        }
+        else
+        {
+            product = mFreeProducts.back();
+            mFreeProducts.pop_back();
+
+            product->SetPlacement(spec.mPlacement);
+            product->SetShape(spec.mShape);
+            product->SetColor(spec.mColor);
+            product->SetContent(spec.mContent);
+            product->SetKick(spec.mKick);
+            product->Reset();
+        }
+
+        mProducts.push_back(product);
+        if (product->IsDisplayed())
+        {
+            mInFlight[spec.mKick]++;
+            mProductIndex.AddTop(product.get());
+            mEmitted.push_back(product.get());
+        }
+        else
+        {
+            // Already off the bottom when the conveyor starts. It was never
+            // counted as in flight, so it must not be resolved out of the count.
+            product->SetResolved();
+            Recycle(product.get());
+        }
+
+        mHasNextProduct = mSource->Next(mNextProduct);
+    }
+
+    if (!mEmitted.empty())
+    {
+        ScheduleEvents();
+    }
+}
+
+/**
+ * Take a product off the belt and keep it for reuse
+ * @param product The product
+ */
+void Conveyor::Recycle(Product *product)
+{
+    ResolveProduct(product, false);
+    mCalendar.Cancel(product);
+    mKickCalendar.Cancel(product);
+
+    auto loc = std::find_if(mProducts.begin(), mProducts.end(),
+                            [product](const std::shared_ptr<Product> &live) { return live.get() == product; });
+    if (loc != mProducts.end())
+    {
+        mFreeProducts.push_back(*loc);
+        *loc = mProducts.back();
+        mProducts.pop_back();
+    }
+}
+
+/**
+ * Schedule the beam, sensor and off screen events for
+ * the products that have just come onto the belt.
+ *
+ * A product at conveyor time t is at Y = GetY() - placement + speed * t,
+ * so the time it reaches any Y can be solved for directly.
+ */
+void Conveyor::ScheduleEvents()
+{
+    if (mSpeed <= 0)
+    {
+        return;
+    }
+
+    auto beam = GetBeam();
+
+    // Crossing times for just the emitted products, computed in bulk
+    mEmittedSlots.clear();
+    for (auto product : mEmitted)
+    {
+        mEmittedSlots.push_back(product->GetSlot());
+    }
+
+    mPool.CrossingTimes(GetGame()->GetHeight(), GetY(), mSpeed, mEmittedSlots, mOffScreenTimes);
+
+    const bool beamEvents = beam != nullptr && beam->Spans(GetX());
+    if (beamEvents)
+    {
+        mPool.CrossingTimes(beam->GetY() - BeamYTolerance, GetY(), mSpeed, mEmittedSlots, mBeamEnterTimes);
+        mPool.CrossingTimes(beam->GetY() + BeamYTolerance, GetY(), mSpeed, mEmittedSlots, mBeamLeaveTimes);
+    }
+
+    const bool sensorEvents = beam != nullptr;
+    if (sensorEvents)
+    {
+        mPool.CrossingTimes(beam->GetY() - SensorTopYTolerance, GetY(), mSpeed, mEmittedSlots, mSensorEnterTimes);
+        mPool.CrossingTimes(beam->GetY() + SensorBottomYTolerance, GetY(), mSpeed, mEmittedSlots,
+                            mSensorLeaveTimes);
+    }
+
+    // Schedule entering and leaving a band of Y values. Products
+    // already past the band when they come on never see it.
+    auto scheduleBand = [this](Product *product, double enterTime, double leaveTime,
+                               EventCalendar::EventType enter, EventCalendar::EventType leave)
+    {
+        if (leaveTime > mTime)
+        {
+            mCalendar.Schedule(std::max(mTime, enterTime), enter, product);
+            mCalendar.Schedule(leaveTime, leave, product);
+        }
+    };
+
+    for (size_t i = 0; i < mEmitted.size(); i++)
+    {
+        auto product = mEmitted[i];
+
+        if (beamEvents)
+        {
+            scheduleBand(product, mBeamEnterTimes[i], mBeamLeaveTimes[i],
+                         EventCalendar::EventType::BeamEnter, EventCalendar::EventType::BeamLeave);
+        }
+
+        if (sensorEvents)
+        {
+            scheduleBand(product, mSensorEnterTimes[i], mSensorLeaveTimes[i],
+                         EventCalendar::EventType::SensorEnter, EventCalendar::EventType::SensorLeave);
+        }
+
+        mCalendar.Schedule(mOffScreenTimes[i], EventCalendar::EventType::OffScreen, product);
+    }
+}
+
+/**
+ * Handle an event from the calendar
+ * @param event The event
+ */
+void Conveyor::HandleEvent(const EventCalendar::Event &event)
+{
+    auto product = event.mProduct;
+    switch (event.mType)
+    {
+    case EventCalendar::EventType::BeamEnter:
+        GetBeam()->ProductEntered(product);
+        break;
+
+    case EventCalendar::EventType::BeamLeave:
+        GetBeam()->ProductLeft(product);
+        break;
+
+    case EventCalendar::EventType::SensorEnter:
+        mSensorProducts.push_back(product);
+        break;
+
+    case EventCalendar::EventType::SensorLeave:
+        mSensorProducts.erase(std::remove(mSensorProducts.begin(), mSensorProducts.end(), product),
+                              mSensorProducts.end());
+        break;
+
+    case EventCalendar::EventType::OffScreen:
+        // Kicked products left the index when they were kicked.
+        // The rest go off the bottom as the last one in the index.
+        if (!product->IsMovingLeft())
+        {
+            mProductIndex.RemoveBottom(product);
+        }
+
+        Recycle(product);
+        break;
+
+    case EventCalendar::EventType::Kick:
+        KickBeamProducts();
+        break;
     }
 }
 
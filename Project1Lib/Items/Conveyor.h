@@ -9,6 +9,16 @@
 #define CONVEYOR_H
 
 #include "../Item.h"
+#include "../ProductIndex.h"
+#include "../EventCalendar.h"
+#include "../ProductPool.h"
+#include "../Sources/ProductSource.h"
+
+#include <array>
+#include <deque>
+
+class Product;
+class Beam;
 
 /**
  * Class that implements a Conveyor
@@ -19,6 +29,9 @@ private:
   /// Boolean for if the conveyor is running or not
   bool mIsRunning = false;
 
+  /// True once the conveyor has been started since the level loaded
+  bool mHasStarted = false;
+
   /// The background image for the conveyor
   std::shared_ptr<wxImage> mConveyorBackgroundImage;
   /// The conveyor belt image
@@ -39,8 +52,82 @@ private:
   /// Speed of the conveyor in Y direction
   int mSpeed = 0;
 
-  /// Current Y Location of the conveyor's moving belt
-  double mBeltY = GetY();
+  /// Time in seconds the belt has been running since it was started
+  double mTime = 0;
+
+  /// Time in seconds kicked products move by. It keeps pace with
+  /// the belt while it runs and keeps going while it is stopped.
+  double mKickClock = 0;
+
+  /// State of the products on this conveyor
+  ProductPool mPool{this};
+
+  /// Where the products come from
+  std::unique_ptr<ProductSource> mSource;
+
+  /// The next product from the source
+  ProductSpec mNextProduct;
+
+  /// True if mNextProduct holds a product
+  bool mHasNextProduct = false;
+
+  /// The products on the belt or being kicked off of it
+  std::vector<std::shared_ptr<Product>> mProducts;
+
+  /// Products that have left and can be reused
+  std::vector<std::shared_ptr<Product>> mFreeProducts;
+
+  /// Index of the products currently on the belt
+  ProductIndex mProductIndex;
+
+  /// Upcoming beam, sensor and off screen events for the products
+  EventCalendar mCalendar;
+
+  /// Off screen events for kicked products, on the kick clock
+  EventCalendar mKickCalendar;
+
+  /// Products in the sensor window, lowest on the belt first
+  std::deque<Product *> mSensorProducts;
+
+  /// Number of products on the belt that are not resolved yet,
+  /// indexed by whether they should be kicked
+  std::array<int, 2> mInFlight{};
+
+  /// Products that came onto the belt in this step. This and the
+  /// buffers below are kept so emitting allocates nothing.
+  std::vector<Product *> mEmitted;
+
+  /// Pool slots of the emitted products
+  std::vector<size_t> mEmittedSlots;
+
+  /// Time each emitted product goes off the bottom
+  std::vector<double> mOffScreenTimes;
+
+  /// Time each emitted product enters the beam
+  std::vector<double> mBeamEnterTimes;
+
+  /// Time each emitted product leaves the beam
+  std::vector<double> mBeamLeaveTimes;
+
+  /// Time each emitted product enters the sensor window
+  std::vector<double> mSensorEnterTimes;
+
+  /// Time each emitted product leaves the sensor window
+  std::vector<double> mSensorLeaveTimes;
+
+  void Restart();
+
+  void EmitProducts(double time);
+
+  void Recycle(Product *product);
+
+  void ScheduleEvents();
+
+  Beam *GetBeam() const;
+
+  void HandleEvent(const EventCalendar::Event &event);
+
+  void KickBeamProducts();
 
 public:
   /// Default constructor (disabled)
@@ -54,17 +141,29 @@ public:
 
   Conveyor(Game *game);
 
+  void Accept(ItemVisitor *visitor) override;
+
   /**
-   * Accept a visitor
-   * @param visitor The visitor we accept
+   * Draw the moving belt and the panel
+   * @param gc The graphics context to draw on
    */
-  void Accept(ItemVisitor *visitor) override { visitor->VisitConveyor(this); }
+  void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
   /**
-   * Draw the conveyor
+   * Draw the frame of the conveyor
    * @param gc The graphics context to draw on
    */
-  void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
+  void DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc) override;
+
+  /**
+   * Does this item draw anything in the static layer?
+   * @return True
+   */
+  bool HasStaticPart() const override { return true; }
+
+  wxRect GetBounds() override;
+
+  void Update(double elapsed) override;
 
   void XmlLoad(wxXmlNode *node) override;
 
@@ -78,11 +177,60 @@ public:
    */
   void Stop();
 
+  void Advance(double elapsed);
+
+  void DrawProducts(const std::shared_ptr<wxGraphicsContext> &gc);
+
+  void SetSource(std::unique_ptr<ProductSource> source);
+
+  void KickProduct(Product *product);
+
+  void ScheduleKick(double delay);
+
+  void ResolveProduct(Product *product, bool scored);
+
   /**
-   * Handle updates for animation
-   * @param elapsed The time since the last update
+   * Get the number of products that are not resolved yet
+   * @return Number of products in flight
    */
-  void Update(double elapsed) override;
+  int GetInFlight() const { return mInFlight[0] + mInFlight[1]; }
+
+  /**
+   * Get the number of products with one outcome that are not resolved yet
+   * @param kick True to count products that should be kicked, false for the others
+   * @return Number of products in flight
+   */
+  int GetInFlight(bool kick) const { return mInFlight[kick]; }
+
+  /**
+   * Is the conveyor done with its products?
+   *
+   * It is done once it has been started, the source has run out
+   * and every product it made has been scored, kicked or gone off
+   * the screen. The last product can be kicked while it is stopped.
+   * @return True if no products are left to resolve
+   */
+  bool IsFinished() const { return mHasStarted && !mHasNextProduct && GetInFlight() == 0; }
+
+  /**
+   * Get the products on the belt or being kicked off of it
+   * @return Products
+   */
+  const std::vector<std::shared_ptr<Product>> &GetProducts() const { return mProducts; }
+
+  /**
+   * Get the index of the products currently on the belt
+   * @return Product index
+   */
+  const ProductIndex &GetProductIndex() const { return mProductIndex; }
+
+  /**
+   * Get the product the sensor is looking at.
+   *
+   * This is the lowest product in the sensor window.
+   * @return Product or nullptr if the sensor window is empty
+   */
+  Product *GetSensedProduct() const { return mSensorProducts.empty() ? nullptr : mSensorProducts.front(); }
 
   /**
    * Getter that returns whether the conveyor is running
@@ -96,6 +244,23 @@ public:
    */
   int GetSpeed() const { return mSpeed; }
 
+  /**
+   * Getter for how long the belt has been running since it was started.
+   *
+   * Product positions are computed from this time.
+   * @return Conveyor time in seconds
+   */
+  double GetTime() const { return mTime; }
+
+  /**
+   * Getter for the clock kicked products move by.
+   *
+   * Unlike the conveyor time, this keeps going while the belt is
+   * stopped, so a product kicked then still goes off the left side.
+   * @return Kick clock time in seconds
+   */
+  double GetKickClock() const { return mKickClock; }
+
   /**
    * Getter for the conveyor's height
    * @return The conveyor's height
@@ -35,7 +35,7 @@ const double LevelNoticePadding = 20;
  * @param levelBegin True if the level begin notice, false if the level end notice
  */
 LevelNotice::LevelNotice(Game *game, int level, bool levelBegin):
-  Item(game)
+  Item(game, ItemType::LevelNotice)
 {
   mLevel = level;
   mLevelBegin = levelBegin;
@@ -53,8 +53,8 @@ void LevelNotice::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
     int screenHeight = GetGame()->GetHeight();
 
     // Set the font
-    auto font = gc->CreateFont(100, L"Arial", wxFONTFLAG_BOLD, LevelNoticeColor);
-    gc->SetFont(font);
+    auto &resources = GetGame()->GetResources();
+    gc->SetFont(resources.GetFont(gc, 100, LevelNoticeColor));
 
     if (mLevelBegin)
     {
@@ -73,9 +73,8 @@ void LevelNotice::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
     int yPos = (screenHeight - NoticeSize) / 4;
 
     // Set a semi-transparent background brush
-    wxBrush semiTransparentBrush(LevelNoticeBackground);
-    gc->SetPen(*wxTRANSPARENT_PEN);
-    gc->SetBrush(semiTransparentBrush);
+    gc->SetPen(resources.GetPen(gc, wxTransparentColour));
+    gc->SetBrush(resources.GetBrush(gc, LevelNoticeBackground));
 
     // Draw the background rectangle
     gc->DrawRectangle(xPos, yPos, NoticeMessageWidth + LevelNoticePadding * 2, NoticeSize + LevelNoticePadding);
@@ -100,6 +99,11 @@ void LevelNotice::Update(double elapsed)
   // Remove notice from view if it has been displayed for LevelNoticeDuration
   if (mTimeElapsed >= LevelNoticeDuration)
   {
+    if (mIsDisplayed)
+    {
+      GetGame()->Damage(GetBounds());
+    }
+
     mIsDisplayed = false;
     mTimeElapsed = 0;
   }
@@ -7,10 +7,10 @@
 #include "Product.h"
 
 #include "Conveyor.h"
-#include "../Visitors/ScoreVisitor.h"
+#include "../PerfectHash.h"
 
 /// Default product size in pixels
-std::wstring ProductDefaultSize = L"80";
+const double ProductDefaultSize = 80;
 
 /// Size to draw content relative to the product size
 double ContentScale = 0.8;
@@ -27,20 +27,15 @@ const wxColour MSUGreen(24, 69, 59);
 /// @return the color
 const wxColor UofMBlue(0, 39, 76);
 
-/// Delay after last product has left beam or
-/// been kicked before we end the level.
-const double LastProductDelay = 3;
 
 
-/// Mapping from the XML strings for properties to
-const std::map<std::wstring, Product::Properties> Product::NamesToProperties = {
-  {L"red", Product::Properties::Red},           {L"green", Product::Properties::Green},
-  {L"blue", Product::Properties::Blue},         {L"white", Product::Properties::White},
-  {L"square", Product::Properties::Square},     {L"circle", Product::Properties::Circle},
-  {L"diamond", Product::Properties::Diamond},   {L"izzo", Product::Properties::Izzo},
-  {L"smith", Product::Properties::Smith},       {L"basketball", Product::Properties::Basketball},
-  {L"football", Product::Properties::Football}, {L"none", Product::Properties::None},
-};
+/// The XML names of the properties, in the order of the Properties enum
+static constexpr std::array<std::wstring_view, 12> PropertyNames = {
+  L"none",   L"red",     L"green", L"blue",  L"white",    L"square",
+  L"circle", L"diamond", L"izzo",  L"smith", L"football", L"basketball"};
+
+/// Table for finding a property from its XML name
+static constexpr PerfectHash<PropertyNames.size()> PropertyNameTable(PropertyNames);
 
 /// Mapping from a property to it's type
 const std::map<Product::Properties, Product::Types> Product::PropertiesToTypes = {
@@ -59,6 +54,22 @@ const std::map<Product::Properties, std::wstring> Product::PropertiesToContentIm
   {Product::Properties::Football, L"football.png"},
   {Product::Properties::Basketball, L"basketball.png"}};
 
+/**
+ * Find a property from its name in a level or product file
+ * @param name The name, like "red" or "square"
+ * @return The property, or nothing if the name is not a property
+ */
+std::optional<Product::Properties> Product::FindProperty(std::wstring_view name)
+{
+  const int index = PropertyNameTable.Find(name);
+  if (index < 0)
+  {
+    return std::nullopt;
+  }
+
+  return Properties(index);
+}
+
 /**
  * Constructor
  * @param game The game this product is a member of
@@ -69,17 +80,28 @@ const std::map<Product::Properties, std::wstring> Product::PropertiesToContentIm
  * @param kick True if the product should be kicked off the conveyor
  */
 Product::Product(Game *game, double placement, Properties shape, Properties color, Properties content, bool kick) :
-    Item(game), mPlacement(placement), mShape(shape), mColor(color), mContent(content), mKick(kick)
+    Product(game, &game->GetProductPool(), placement, shape, color, content, kick)
 {
-  // Load content image if there is content
-  if (content != Properties::None)
-  {
-    auto iter = PropertiesToContentImages.find(content);
-    if (iter != PropertiesToContentImages.end())
-    {
-      mProductImage = GetGame()->GetImage(iter->second);
-    }
-  }
+}
+
+/**
+ * Constructor
+ * @param game The game this product is a member of
+ * @param pool The pool that holds the state of the product
+ * @param placement The placement of the product on the conveyor
+ * @param shape The shape of the product
+ * @param color The color of the product
+ * @param content The content of the product
+ * @param kick True if the product should be kicked off the conveyor
+ */
+Product::Product(Game *game, ProductPool *pool, double placement, Properties shape, Properties color,
+                 Properties content, bool kick) :
+    Item(game, ItemType::Product), mPool(pool)
+{
+  mSlot = uint32_t(mPool->Add(placement, 0, kick ? ProductPool::Kick : 0));
+  SetShape(shape);
+  SetColor(color);
+  SetContent(content);
 }
 
 /**
@@ -88,39 +110,40 @@ Product::Product(Game *game, double placement, Properties shape, Properties colo
  */
 void Product::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
-  if (!mIsCurrentlyDisplayed)
+  if (!IsDisplayed())
     return;
 
   // Save the graphics state
   gc->PushState();
 
   // Set transparent pen for no outlines
-  gc->SetPen(*wxTRANSPARENT_PEN);
+  auto &resources = GetGame()->GetResources();
+  gc->SetPen(resources.GetPen(gc, wxTransparentColour));
 
   // Set the color based on the product's color property
-  switch (mColor)
+  switch (GetColor())
   {
   case Properties::Red:
-    gc->SetBrush(wxBrush(OhioStateRed));
+    gc->SetBrush(resources.GetBrush(gc, OhioStateRed));
     break;
   case Properties::Green:
-    gc->SetBrush(wxBrush(MSUGreen));
+    gc->SetBrush(resources.GetBrush(gc, MSUGreen));
     break;
   case Properties::Blue:
-    gc->SetBrush(wxBrush(UofMBlue));
+    gc->SetBrush(resources.GetBrush(gc, UofMBlue));
     break;
   default:
-    gc->SetBrush(*wxWHITE_BRUSH);
+    gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
     break;
   }
 
   // Calculate the center position
   double centerX = GetX();
   double centerY = GetY();
-  double size = std::stod(ProductDefaultSize);
+  const double size = ProductDefaultSize;
 
   // Draw the shape
-  switch (mShape)
+  switch (GetShape())
   {
   case Properties::Square:
     gc->DrawRectangle(centerX - size / 2, centerY - size / 2, size, size);
@@ -144,13 +167,15 @@ void Product::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
     break;
   }
 
-  // Draw the content image if it exists
-  if (mContent != Properties::None && mProductImage)
+  // Draw the content image if it exists. The image is shared
+  // by every product with the same content.
+  if (auto image = GetGame()->GetPropertyImage(size_t(GetContent())); image != nullptr)
   {
     double contentSize = size * ContentScale;
     double contentX = centerX - contentSize / 2;
     double contentY = centerY - contentSize / 2;
-    gc->DrawBitmap(*mProductImage, contentX, contentY, contentSize, contentSize);
+    gc->DrawBitmap(GetGame()->GetSprite(gc, *image, contentSize, contentSize), contentX, contentY, contentSize,
+                   contentSize);
   }
 
   // Restore the graphics state
@@ -158,16 +183,122 @@ void Product::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 }
 
 /**
- * Start moving product to the left
+ * Get the X location of the product.
+ *
+ * A product on a conveyor rides along the conveyor until it is
+ * kicked, then moves to the left at a constant speed. It keeps
+ * moving by the conveyor's kick clock while the belt is stopped.
+ * @return X location in virtual pixels
  */
-void Product::HasLeftBeam()
+double Product::GetX() const
+{
+  auto conveyor = mPool->GetConveyor();
+  if (conveyor == nullptr)
+  {
+    return Item::GetX();
+  }
+
+  if (IsMovingLeft())
+  {
+    return conveyor->GetX() - MovingLeftSpeed * (conveyor->GetKickClock() - mPool->GetKickClock(mSlot));
+  }
+
+  return conveyor->GetX();
+}
+
+/**
+ * Get the Y location of the product.
+ *
+ * The product starts its placement above the conveyor and moves down
+ * with the belt. Once kicked it stays at the Y where it was kicked.
+ * @return Y location in virtual pixels
+ */
+double Product::GetY() const
 {
-  if (mLast)
+  auto conveyor = mPool->GetConveyor();
+  if (conveyor == nullptr)
   {
-    GetGame()->EndLevel();
+    return Item::GetY();
   }
 
-  // Update score
-  ScoreVisitor scoreVisitor(this);
-  GetGame()->Accept(&scoreVisitor);
+  const double time = IsMovingLeft() ? mPool->GetKickTime(mSlot) : conveyor->GetTime();
+  return conveyor->GetY() - GetPlacement() + conveyor->GetSpeed() * time;
+}
+
+/**
+ * Is the product still on the screen?
+ *
+ * Products disappear when they go off the bottom of the game or
+ * when a kick has moved them off the left side.
+ * @return True if the product is displayed
+ */
+bool Product::IsDisplayed() const
+{
+  if (GetY() > GetGame()->GetHeight())
+  {
+    return false;
+  }
+
+  auto conveyor = mPool->GetConveyor();
+  return conveyor == nullptr || GetX() >= -conveyor->GetX();
+}
+
+/**
+ * Kick the product off of the conveyor
+ * @param time Conveyor time of the kick
+ * @param clock Kick clock time of the kick
+ */
+void Product::Kick(double time, double clock)
+{
+  mPool->SetFlag(mSlot, ProductPool::MovingLeft, true);
+  mPool->SetKickTime(mSlot, time);
+  mPool->SetKickClock(mSlot, clock);
+}
+
+/**
+ * Put the product back in its starting state on the conveyor
+ */
+void Product::Reset()
+{
+  mPool->SetFlag(mSlot, ProductPool::MovingLeft, false);
+  mPool->SetFlag(mSlot, ProductPool::BeamHit, false);
+  mPool->SetFlag(mSlot, ProductPool::Resolved, false);
+  mPool->SetKickTime(mSlot, 0);
+  mPool->SetKickClock(mSlot, 0);
+}
+
+/**
+ * Get one of the properties from the packed properties
+ * @param shift Bit offset of the property
+ * @return The property
+ */
+Product::Properties Product::GetProperty(int shift) const
+{
+  return Properties((mPool->GetProperties(mSlot) >> shift) & 0xF);
+}
+
+/**
+ * Set one of the properties in the packed properties
+ * @param shift Bit offset of the property
+ * @param property The property
+ */
+void Product::SetProperty(int shift, Properties property)
+{
+  const auto properties = mPool->GetProperties(mSlot) & ~(0xF << shift);
+  mPool->SetProperties(mSlot, uint16_t(properties | (int(property) << shift)));
+}
+
+/**
+ * Score the product once it has left the beam.
+ *
+ * The score is recorded on the product's line and applied to
+ * the game after the lines have updated.
+ */
+void Product::HasLeftBeam()
+{
+  auto conveyor = mPool->GetConveyor();
+  if (conveyor != nullptr)
+  {
+    conveyor->ResolveProduct(this, true);
+  }
 }
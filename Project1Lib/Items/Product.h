@@ -9,8 +9,11 @@
 #define PRODUCT_H
 #include "../Game.h"
 #include "../XmlLoader.h"
+#include "../ProductPool.h"
 
 #include <map>
+#include <optional>
+#include <string_view>
 
 
 class Conveyor;
@@ -24,7 +27,7 @@ public:
   /// The possible product properties.
   /// The None properties allows us to indicate that
   /// the product has no content.
-  enum class Properties
+  enum class Properties : uint8_t
   {
     None,
     Red,
@@ -48,9 +51,7 @@ public:
     Content
   };
 
-  /// Mapping from the XML strings for properties to
-  /// the Properties enum and the type of the property.
-  static const std::map<std::wstring, Properties> NamesToProperties;
+  static std::optional<Properties> FindProperty(std::wstring_view name);
 
   /// Mapping from a property to it's type
   static const std::map<Properties, Types> PropertiesToTypes;
@@ -58,6 +59,13 @@ public:
   /// Mapping from content properties to their associated image
   static const std::map<Properties, std::wstring> PropertiesToContentImages;
 
+  /**
+   * Get the bit for a property in a property mask
+   * @param property The property
+   * @return Mask with only that property's bit set
+   */
+  static constexpr uint32_t PropertyBit(Properties property) { return 1u << int(property); }
+
   /// Default constructor (disabled)
   Product() = delete;
 
@@ -67,9 +75,16 @@ public:
   /// Assignment operator (disabled)
   void operator=(const Product &) = delete;
 
+  /// Speed with which product moves off conveyor once kicked
+  /// in pixels per second
+  static constexpr double MovingLeftSpeed = 2500;
+
   Product(Game *game, double placement, Properties shape, Properties color, Properties content = Properties::None,
           bool kick = false);
 
+  Product(Game *game, ProductPool *pool, double placement, Properties shape, Properties color, Properties content,
+          bool kick);
+
   /**
    * Accept a visitor
    * @param visitor The visitor we accept
@@ -82,11 +97,21 @@ public:
    */
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
+  double GetX() const override;
+
+  double GetY() const override;
+
+  bool IsDisplayed() const;
+
+  void Kick(double time, double clock);
+
+  void Reset();
+
   /**
-   * Start moving product to the left
-   * @param moving True if the product is moving left
+   * Get the slot of this product in its pool
+   * @return Slot
    */
-  void SetMovingLeft(const bool moving = true) { mMovingLeft = moving; }
+  size_t GetSlot() const { return mSlot; }
 
 
   /**
@@ -98,120 +123,118 @@ public:
    * Find whether to kick
    * @return True if the product should be kicked
    */
-  bool ShouldKick() const { return mKick; }
+  bool ShouldKick() const { return mPool->HasFlag(mSlot, ProductPool::Kick); }
 
   /**
    * Get the placement of the product on the conveyor
    * @return The placement of the product
    */
-  double GetPlacement() const { return mPlacement; }
+  double GetPlacement() const { return mPool->GetPlacement(mSlot); }
 
   /**
    * Get the shape of the product
    * @return The shape of the product
    */
-  Properties GetShape() const { return mShape; }
+  Properties GetShape() const { return GetProperty(ShapeShift); }
 
   /**
    * Get the color of the product
    * @return The color of the product
    */
-  Properties GetColor() const { return mColor; }
+  Properties GetColor() const { return GetProperty(ColorShift); }
 
   /**
    * Get the content of the product
    * @return The content of the product
    */
-  Properties GetContent() const { return mContent; }
+  Properties GetContent() const { return GetProperty(ContentShift); }
+
+  /**
+   * Get the shape, color and content of the product as a mask
+   * of property bits
+   * @return Property mask
+   */
+  uint32_t GetPropertyMask() const
+  {
+    return PropertyBit(GetShape()) | PropertyBit(GetColor()) | PropertyBit(GetContent());
+  }
 
   /**
    * Set the placement of the product on the conveyor
    * @param placement The placement of the product
    */
-  void SetPlacement(double placement) { mPlacement = placement; }
+  void SetPlacement(double placement) { mPool->SetPlacement(mSlot, placement); }
 
   /**
    * Set the shape of the product
    * @param shape The shape of the product
    */
-  void SetShape(Properties shape) { mShape = shape; }
+  void SetShape(Properties shape) { SetProperty(ShapeShift, shape); }
 
   /**
    * Set the color of the product
    * @param color The color of the product
    */
-  void SetColor(Properties color) { mColor = color; }
+  void SetColor(Properties color) { SetProperty(ColorShift, color); }
 
   /**
    * Set the content of the product
    * @param content The content of the product
    */
-  void SetContent(Properties content) { mContent = content; }
+  void SetContent(Properties content) { SetProperty(ContentShift, content); }
 
   /**
    * Set whether the product should be kicked
    * @param kick Whether the product should be kicked
    */
-  void SetKick(bool kick) { mKick = kick; }
+  void SetKick(bool kick) { mPool->SetFlag(mSlot, ProductPool::Kick, kick); }
 
   /**
-   * set the product to be the last product on the conveyor
+   * Set whether the product has been scored or can no longer be
+   * @param resolved True if the product is resolved
    */
-  void SetLast() { mLast = true; }
+  void SetResolved(bool resolved = true) { mPool->SetFlag(mSlot, ProductPool::Resolved, resolved); }
 
   /**
-   * Get whether the product is the last product on the conveyor
-   * @return true if the product is the last product on the conveyor, false otherwise
+   * Get whether the product has been scored or can no longer be
+   * @return true if the product is resolved, false if it is still in flight
    */
-  bool IsLast() const { return mLast; }
+  bool IsResolved() const { return mPool->HasFlag(mSlot, ProductPool::Resolved); }
 
   /**
    * Get whether the product is moving left
    * @return true if the product is moving left, false otherwise
    */
-  bool IsMovingLeft() const { return mMovingLeft; }
+  bool IsMovingLeft() const { return mPool->HasFlag(mSlot, ProductPool::MovingLeft); }
 
   /**
    * Get whether this product has hit the beam
    * @return true if the product has hit the beam, false otherwise
    */
-  bool GetBeamHit() const { return mBeamHit; }
+  bool GetBeamHit() const { return mPool->HasFlag(mSlot, ProductPool::BeamHit); }
 
   /**
    * Set whether this product has hit the beam
    * @param beamHit the value to assigned to beam hit
    */
-  void SetBeamHit(bool beamHit) { mBeamHit = beamHit; }
-
-  /// True if the product is currently displayed, false otherwise
-  bool mIsCurrentlyDisplayed = true;
+  void SetBeamHit(bool beamHit) { mPool->SetFlag(mSlot, ProductPool::BeamHit, beamHit); }
 
 private:
-  /// The placement of the product on the conveyor
-  double mPlacement = 0;
-  /// The color of the product
-  Properties mColor = Properties::Red;
-  /// The shape of the product
-  Properties mShape = Properties::Square;
-  /// The content of the product
-  Properties mContent = Properties::None;
-  /// Whether the product should be kicked off the conveyor
-  bool mKick = false;
-  /// Is the product moving left (after being kicked)?
-  bool mMovingLeft = false;
-  /// Has the product hit the beam?
-  bool mBeamHit = false;
-  /// The product image
-  std::shared_ptr<wxImage> mProductImage;
-
-  /// True if product is the last product on the conveyor
-  bool mLast = false;
-
-  /// Delay after the last product has left the conveyor
-  double mLastProductDelay = 0.0;
-
-  /// The size of the product
-  double mSize = 80.0;
+  /// Bit offset of the shape in the packed properties
+  static constexpr int ShapeShift = 0;
+  /// Bit offset of the color in the packed properties
+  static constexpr int ColorShift = 4;
+  /// Bit offset of the content in the packed properties
+  static constexpr int ContentShift = 8;
+
+  Properties GetProperty(int shift) const;
+
+  void SetProperty(int shift, Properties property);
+
+  /// The pool that holds the state of this product
+  ProductPool *mPool;
+  /// Slot of this product in the pool
+  uint32_t mSlot;
 };
 
 
@@ -6,7 +6,6 @@
 #include "../pch.h"
 #include "Scoreboard.h"
 
-#include "../Visitors/BadgeVisitor.h"
 #include "../Game.h"
 
 #include <regex>
@@ -26,14 +25,30 @@ const int SpacingInstructionLines = 17;
 /// Scoreboard padding
 const int SpacingBoxToScores = 10;
 
+/// Color to draw the scores
+const wxColour ScoreColor = wxColour(24, 69, 59);
+
+/// Height of the part of the scoreboard the scores are drawn in
+const int ScoresHeight = SpacingBoxToScores + SpacingScoresToInstructions;
+
 /**
  * Constructor
  * @param game The game this scoreboard is a member of
  * @param score The score object
  */
 Scoreboard::Scoreboard(Game *game, Score *score) :
-  Item(game), mScore(score)
+  Item(game, ItemType::Scoreboard), mScore(score)
 {
+  mScore->AddObserver(this);
+  ScoreChanged(mScore);
+}
+
+/**
+ * Destructor
+ */
+Scoreboard::~Scoreboard()
+{
+  mScore->RemoveObserver(this);
 }
 
 /**
@@ -47,31 +62,19 @@ void Scoreboard::XmlLoad(wxXmlNode *node)
 }
 
 /**
- * Draw the scoreboard
+ * Draw the box and the instructions of the scoreboard
  * @param gc The graphics context to draw on
  */
-void Scoreboard::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+void Scoreboard::DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc)
 {
   // Draw the background
-  gc->SetPen(*wxBLACK);
-  gc->SetBrush(*wxWHITE);
+  auto &resources = GetGame()->GetResources();
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
+  gc->SetBrush(resources.GetBrush(gc, *wxWHITE));
   gc->DrawRectangle(GetX(), GetY(), ScoreboardSize.GetWidth(), ScoreboardSize.GetHeight());
 
-  // Score font
-  auto font = gc->CreateFont(25, L"Arial", wxFONTFLAG_BOLD, wxColour(24, 69, 59));
-  gc->SetFont(font);
-
-  std::wostringstream level, game;
-  level << L"Level: " << mScore->GetLevelScore(); // Fetch the level score from Score object
-  game << L"Game: " << mScore->GetGameScore(); // Fetch the game score from Score object
-
-  // Draw the scores
-  gc->DrawText(level.str(), GetX() + SpacingBoxToScores, GetY() + SpacingBoxToScores);
-  gc->DrawText(game.str(), GetX() + SpacingBoxToScores + ScoreboardSize.GetWidth() / 2.0, GetY() + SpacingBoxToScores);
-
   // Instructions font
-  font = gc->CreateFont(15, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-  gc->SetFont(font);
+  gc->SetFont(resources.GetFont(gc, 15, *wxBLACK));
 
   // Draw the instructions
   const double xLeft = GetX();
@@ -84,28 +87,44 @@ void Scoreboard::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 }
 
 /**
- * Update the scoreboard
- * @param isCorrect True if the answer is correct, false otherwise
+ * Draw the scores, which change as products are scored
+ * @param gc The graphics context to draw on
  */
-void Scoreboard::UpdateScore(bool isCorrect)
+void Scoreboard::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
-  mScore->UpdateLevelScore(isCorrect);
-  BadgeVisitor badgeVisitor(mScore);
-  GetGame()->Accept(&badgeVisitor);
+  // Score font
+  gc->SetFont(GetGame()->GetResources().GetFont(gc, 25, ScoreColor));
+
+  // Draw the scores
+  gc->DrawText(mLevelText, GetX() + SpacingBoxToScores, GetY() + SpacingBoxToScores);
+  gc->DrawText(mGameText, GetX() + SpacingBoxToScores + ScoreboardSize.GetWidth() / 2.0, GetY() + SpacingBoxToScores);
 }
 
 /**
- * Reset the Scoreboard's score to zero
+ * Get the area the scoreboard is drawn in, with the
+ * instructions if they run past the bottom of the box
+ * @return Bounding rectangle in virtual pixels
  */
-void Scoreboard::ResetScore()
+wxRect Scoreboard::GetBounds()
 {
-  mScore->Reset();
+  const int textBottom = SpacingBoxToScores + SpacingScoresToInstructions +
+                         int(mText.size() + 1) * SpacingInstructionLines;
+  return wxRect(GetX(), GetY(), ScoreboardSize.GetWidth(), std::max(ScoreboardSize.GetHeight(), textBottom));
 }
 
 /**
- * Update the scoreboard when levels change
+ * Rebuild the score text when the score changes
+ * @param score The score that changed
  */
-void Scoreboard::UpdateLevelChangeScore()
+void Scoreboard::ScoreChanged(Score *score)
 {
-  mScore->EndLevel();
+  std::wostringstream level, game;
+  level << L"Level: " << score->GetLevelScore(); // Fetch the level score from Score object
+  game << L"Game: " << score->GetGameScore(); // Fetch the game score from Score object
+
+  mLevelText = level.str();
+  mGameText = game.str();
+
+  // Only the scores are drawn again, over the box in the static layer
+  GetGame()->Damage(wxRect(GetX(), GetY(), ScoreboardSize.GetWidth(), ScoresHeight));
 }
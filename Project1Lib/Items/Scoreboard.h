@@ -11,17 +11,24 @@
 #include "../Item.h"
 #include "../Visitors/ItemVisitor.h"
 #include "../Score.h"
+#include "../IScoreObserver.h"
 #include "../XmlLoader.h"
 
 /**
  * Class for the scoreboard
  */
-class Scoreboard : public Item
+class Scoreboard : public Item, public IScoreObserver
 {
 private:
   /// The score object
   Score *mScore; // Reference to the score visitor object
 
+  /// Level score text, rebuilt when the score changes
+  std::wstring mLevelText;
+
+  /// Game score text, rebuilt when the score changes
+  std::wstring mGameText;
+
   /// The text to display
   std::vector<std::string> mText; // Instructions to display
 
@@ -37,6 +44,8 @@ public:
 
   Scoreboard(Game *game, Score *score);
 
+  ~Scoreboard() override;
+
   /**
   * Accept a visitor
   * @param visitor The visitor we accept
@@ -45,16 +54,19 @@ public:
 
   void XmlLoad(wxXmlNode *node) override;
 
-  /**
-   * Draw the scoreboard
-   */
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
 
+  void DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc) override;
+
   /**
-   * Update the scoreboard
-   * @param isCorrect True if the answer is correct, false otherwise
+   * Does this item draw anything in the static layer?
+   * @return True
    */
-  void UpdateScore(bool isCorrect);
+  bool HasStaticPart() const override { return true; }
+
+  wxRect GetBounds() override;
+
+  void ScoreChanged(Score *score) override;
 
   /**
    * Set the text to display
@@ -67,13 +79,6 @@ public:
    * @return The text to display
    */
   Score *GetScore() { return mScore; }
-
-  /**
-   * Reset the score
-   */
-  void ResetScore();
-
-  void UpdateLevelChangeScore();
 };
 
 
@@ -7,6 +7,8 @@
 #include "../Game.h"
 #include "Sensor.h"
 #include "../Gates/SensorGate.h"
+#include "../ProductionLine.h"
+#include "Conveyor.h"
 
 #include <string>
 
@@ -39,7 +41,7 @@ const wxColour PanelBackgroundColor(128, 128, 128);
  * @param game Game this sensor is a member of
  */
 Sensor::Sensor(Game *game) :
-  Item(game)
+  Item(game, ItemType::Sensor)
 {
 }
 
@@ -47,22 +49,26 @@ Sensor::Sensor(Game *game) :
  * Draw the sensor
  * @param gc The graphics context to draw on
  */
-void Sensor::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+void Sensor::DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc)
 {
   // Draw the sensor camera
   auto sensorCameraImage = GetGame()->GetImage(SensorCameraImage);
   int sensorCameraCenterX = GetX();
   int sensorCameraCenterY = GetY();
-  gc->DrawBitmap(*sensorCameraImage, sensorCameraCenterX - sensorCameraImage->GetWidth() / 2,
-                 sensorCameraCenterY - sensorCameraImage->GetHeight() / 2,
-                 sensorCameraImage->GetWidth(), sensorCameraImage->GetHeight());
+  const double cameraWidth = sensorCameraImage->GetWidth();
+  const double cameraHeight = sensorCameraImage->GetHeight();
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *sensorCameraImage, cameraWidth, cameraHeight),
+                 sensorCameraCenterX - sensorCameraImage->GetWidth() / 2,
+                 sensorCameraCenterY - sensorCameraImage->GetHeight() / 2, cameraWidth, cameraHeight);
 
   // Draw the sensor cable, starting directly beneath the camera
   auto sensorCableImage = GetGame()->GetImage(SensorCableImage);
   int cableStartX = sensorCameraCenterX - sensorCableImage->GetWidth() / 2;
   int cableStartY = sensorCameraCenterY - sensorCameraImage->GetHeight() / 2;
-  gc->DrawBitmap(*sensorCableImage, cableStartX, cableStartY,
-                 sensorCableImage->GetWidth(), sensorCableImage->GetHeight());
+  const double cableWidth = sensorCableImage->GetWidth();
+  const double cableHeight = sensorCableImage->GetHeight();
+  gc->DrawBitmap(GetGame()->GetSprite(gc, *sensorCableImage, cableWidth, cableHeight), cableStartX, cableStartY,
+                 cableWidth, cableHeight);
 }
 
 /**
@@ -74,3 +80,42 @@ void Sensor::XmlLoad(wxXmlNode *node)
   XmlLoader loader(GetGame());
   loader.LoadSensor(this, node);
 }
+
+/**
+ * Get the area the sensor is drawn in
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect Sensor::GetBounds()
+{
+  auto sensorCameraImage = GetGame()->GetImage(SensorCameraImage);
+  auto sensorCableImage = GetGame()->GetImage(SensorCableImage);
+  const int x = GetX();
+  const int y = GetY();
+
+  wxRect bounds(x - sensorCameraImage->GetWidth() / 2, y - sensorCameraImage->GetHeight() / 2,
+                sensorCameraImage->GetWidth(), sensorCameraImage->GetHeight());
+  bounds.Union(wxRect(x - sensorCableImage->GetWidth() / 2, y - sensorCameraImage->GetHeight() / 2,
+                      sensorCableImage->GetWidth(), sensorCableImage->GetHeight()));
+  return bounds;
+}
+
+/**
+ * Sample the product in the sensor window.
+ *
+ * This happens once per tick, before the sensor gates compute
+ * their outputs from the sample.
+ * @param elapsed The time since the last update
+ */
+void Sensor::Update(double elapsed)
+{
+  mSample = 0;
+
+  auto conveyor = GetLine() != nullptr ? GetLine()->GetConveyor() : nullptr;
+  if (conveyor != nullptr)
+  {
+    if (auto product = conveyor->GetSensedProduct(); product != nullptr)
+    {
+      mSample = product->GetPropertyMask();
+    }
+  }
+}
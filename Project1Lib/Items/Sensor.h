@@ -38,10 +38,18 @@ public:
   void Accept(ItemVisitor *visitor) override { visitor->VisitSensor(this); }
 
   /**
-   * Draw the sensor
+   * Draw the sensor, which never changes, into the static layer
    * @param gc The graphics context to draw on
    */
-  void Draw(const std::shared_ptr<wxGraphicsContext> &gc) override;
+  void DrawStatic(const std::shared_ptr<wxGraphicsContext> &gc) override;
+
+  /**
+   * Does this item draw anything in the static layer?
+   * @return True
+   */
+  bool HasStaticPart() const override { return true; }
+
+  wxRect GetBounds() override;
 
   /**
    * Load the attributes for a sensor from an XML node
@@ -49,9 +57,20 @@ public:
    */
   void XmlLoad(wxXmlNode *node) override;
 
+  void Update(double elapsed) override;
+
+  /**
+   * Get the properties of the product the sensor sees this tick
+   * @return Property mask of the product, or 0 if there is none
+   */
+  uint32_t GetSample() const { return mSample; }
+
 private:
   /// Image for the sensor camera
   std::shared_ptr<wxImage> mSensorCameraImage;
+
+  /// Property mask of the product the sensor sees this tick
+  uint32_t mSample = 0;
 };
 
 #endif // SENSOR_H
@@ -0,0 +1,54 @@
+/**
+ * @file LevelArena.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "LevelArena.h"
+
+#include <cassert>
+
+/**
+ * Destructor
+ *
+ * The blocks are released with the arena, so nothing made in
+ * it can still be in use.
+ */
+LevelArena::~LevelArena()
+{
+  assert(mLive == 0);
+}
+
+/**
+ * Allocate memory
+ * @param bytes Size in bytes
+ * @param alignment Alignment in bytes
+ * @return The memory
+ */
+void *LevelArena::do_allocate(size_t bytes, size_t alignment)
+{
+  mLive++;
+  return mPool.allocate(bytes, alignment);
+}
+
+/**
+ * Free memory, putting it on the free list for its size
+ * @param p The memory
+ * @param bytes Size in bytes
+ * @param alignment Alignment in bytes
+ */
+void LevelArena::do_deallocate(void *p, size_t bytes, size_t alignment)
+{
+  mLive--;
+  mPool.deallocate(p, bytes, alignment);
+}
+
+/**
+ * Is another memory resource the same as this one?
+ * @param other The other resource
+ * @return True only if it is this arena
+ */
+bool LevelArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+  return this == &other;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file LevelArena.h
+ * @author Nitish Maindoliya
+ *
+ * Memory for the objects that make up one level.
+ */
+
+#ifndef LEVELARENA_H
+#define LEVELARENA_H
+
+#include <memory>
+#include <memory_resource>
+
+/**
+ * Memory for the items, pins and wires of one level.
+ *
+ * Everything is carved out of large blocks that are all
+ * released together when the arena is destroyed, so loading
+ * and unloading a level does not go through the heap once per
+ * object. Memory that is freed during the level, like a gate
+ * the player deletes, goes back on a free list for its size
+ * and is reused for the next object of that size.
+ *
+ * The arena is not thread safe. Only create level objects on
+ * the main thread.
+ *
+ * Objects made in an arena must not outlive it. Everything made
+ * in it has to be freed before it is destroyed.
+ */
+class LevelArena : public std::pmr::memory_resource
+{
+private:
+  /// The big blocks everything comes from
+  std::pmr::monotonic_buffer_resource mBuffer;
+
+  /// Free lists by size, on top of the blocks
+  std::pmr::unsynchronized_pool_resource mPool{&mBuffer};
+
+  /// Number of allocations that have not been freed
+  size_t mLive = 0;
+
+protected:
+  void *do_allocate(size_t bytes, size_t alignment) override;
+
+  void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+public:
+  /// Constructor
+  LevelArena() = default;
+
+  ~LevelArena() override;
+
+  /// Copy constructor (disabled)
+  LevelArena(const LevelArena &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const LevelArena &) = delete;
+
+  /**
+   * Create an object in the arena.
+   *
+   * The object and its reference count are one allocation.
+   * @tparam T Type of object
+   * @tparam Args Types of the constructor arguments
+   * @param args Constructor arguments
+   * @return Shared pointer to the object
+   */
+  template <class T, class... Args>
+  std::shared_ptr<T> Make(Args &&...args)
+  {
+    return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(this), std::forward<Args>(args)...);
+  }
+
+  /**
+   * Get the number of allocations that have not been freed.
+   *
+   * An arena can only be destroyed once this is zero.
+   * @return Number of live allocations
+   */
+  size_t GetLive() const { return mLive; }
+};
+
+#endif // LEVELARENA_H
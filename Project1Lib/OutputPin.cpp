@@ -13,21 +13,6 @@
 /// Diameter to draw the pin in pixels
 static const int PinSize = 10;
 
-/// Length of Plus lines
-static const int PlusSize = 20;
-
-/// Offset for Point labels
-static const wxSize PointLabelOffset = wxSize(PlusSize / 4, PlusSize * -1.5);
-
-/// Color to use for drawing a zero connection wire
-const wxColour ConnectionColorZero = *wxBLACK;
-
-/// Color to use for drawing a one connection wire
-const wxColour ConnectionColorOne = *wxRED;
-
-/// Color to use for drawing an unknown state connection wire
-const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
-
 /**
  * Constructor
  * @param gate The gate this pin is a member of
@@ -37,160 +22,121 @@ const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
 OutputPin::OutputPin(Gate *gate, const wxPoint location, OutputPinTypes type) :
     mGate(gate), mLocation(location), mType(type)
 {
+  mHandle = gate->GetGame()->GetOutputPinSlots().Insert(this);
 }
 
 /**
- * Draw the output pin
+ * Destructor
+ */
+OutputPin::~OutputPin()
+{
+  auto game = mGate->GetGame();
+  game->GetOutputPinSlots().Remove(mHandle);
+  game->GetWires().RemoveOutput(mHandle);
+}
+
+/**
+ * Draw the output pin and the wires from it
  * @param gc The graphics context to draw on
  */
 void OutputPin::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
 {
-  int locationX = mGate->GetX() + mLocation.x;
-  int locationY = mGate->GetY() + mLocation.y;
-
-  wxColour color;
-  switch (mState)
-  {
-  case States::Zero:
-    color = ConnectionColorZero;
-    break;
-  case States::One:
-    color = ConnectionColorOne;
-    break;
-  default:
-    color = ConnectionColorUnknown;
-    break;
-  }
+  const auto location = GetAbsoluteLocation();
+  auto game = mGate->GetGame();
+  auto &resources = game->GetResources();
+  const auto &colour = WirePath::GetColour(mState);
+  const auto &pen = resources.GetPen(gc, colour, LineWidth);
 
   // Set the pen for drawing
-  gc->SetPen(wxPen(color, LineWidth));
+  gc->SetPen(pen);
 
   // Set the brush for drawing
-  gc->SetBrush(wxBrush(color));
+  gc->SetBrush(resources.GetBrush(gc, colour));
 
   // Draw the wire
-  gc->StrokeLine(locationX, locationY, locationX - DefaultLineLength, locationY);
+  gc->StrokeLine(location.x, location.y, location.x - DefaultLineLength, location.y);
 
   // Set black pen for drawing the pin's circular borders
-  gc->SetPen(*wxBLACK_PEN);
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
 
   // Draw the pin as a circle
-  gc->DrawEllipse(locationX - PinSize / 2, locationY - PinSize / 2, PinSize, PinSize);
+  gc->DrawEllipse(location.x - PinSize / 2, location.y - PinSize / 2, PinSize, PinSize);
 
   // Reset the pen for drawing draggable wires
-  gc->SetPen(wxPen(color, LineWidth));
+  gc->SetPen(pen);
 
-  if(mDragging)
+  if (mDragging)
   {
-    double distance = sqrt(pow((locationX - mWireEnd.x), 2) + pow((locationY - mWireEnd.y), 2));
-    double offset = std::min(BezierMaxOffset, distance);
-
-    wxPoint2DDouble p1(locationX, locationY); // p1
-    wxPoint2DDouble p2(locationX + offset, locationY); // p2
-    wxPoint2DDouble p3(mWireEnd.x - offset, mWireEnd.y); // p3
-
-    wxGraphicsPath path = gc->CreatePath();
-
-    path.MoveToPoint(p1);
-    path.AddCurveToPoint(p2, p3, mWireEnd);
-
-    gc->StrokePath(path);
+    mDragWire.SetEnds(location, mWireEnd);
+    mDragWire.Draw(gc);
 
     if (mShowControlPoints)
     {
-      // Draw the red pluses
-      gc->SetPen(*wxRED_PEN);
-
-      gc->StrokeLine(p1.m_x - PlusSize/2, p1.m_y, p1.m_x + PlusSize/2, p2.m_y);
-      gc->StrokeLine(p1.m_x, p1.m_y - PlusSize/2, p1.m_x, p2.m_y + PlusSize/2);
-
-      gc->StrokeLine(p2.m_x - PlusSize/2, p2.m_y, p2.m_x + PlusSize/2, p2.m_y);
-      gc->StrokeLine(p2.m_x, p2.m_y - PlusSize/2, p2.m_x, p2.m_y + PlusSize/2);
-
-      gc->StrokeLine(p3.m_x - PlusSize/2, p3.m_y, p3.m_x + PlusSize/2, p3.m_y);
-      gc->StrokeLine(p3.m_x, p3.m_y - PlusSize/2, p3.m_x, p3.m_y + PlusSize/2);
-
-      gc->StrokeLine(mWireEnd.x - PlusSize/2, mWireEnd.y, mWireEnd.x + PlusSize/2, mWireEnd.y);
-      gc->StrokeLine(mWireEnd.x, mWireEnd.y - PlusSize/2, mWireEnd.x, mWireEnd.y + PlusSize/2);
-
-      // Draw the green parallelogram
-      path = gc->CreatePath();
-      gc->SetPen(*wxGREEN_PEN);
+      mDragWire.DrawControlPoints(gc, resources);
+      gc->SetPen(pen);
+    }
+  }
 
-      path.MoveToPoint(p1.m_x, p1.m_y);
-      path.AddLineToPoint(p2.m_x, p2.m_y);
-      path.AddLineToPoint(mWireEnd.x, mWireEnd.y);
-      path.AddLineToPoint(p3.m_x, p3.m_y);
-      path.AddLineToPoint(p1.m_x, p1.m_y);
-      gc->StrokePath(path);
+  // Each wire keeps its curve, which only changes when a gate moves
+  for (auto caught : game->GetWires().GetFanout(mHandle))
+  {
+    auto inputPin = game->GetInputPinSlots().Get(caught);
 
-      // Draw black labels for points p1, p2, p3, p3
-      gc->SetPen(*wxBLACK_PEN);
-      gc->DrawText(L"p1",p1.m_x + PointLabelOffset.x, p1.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p2",p2.m_x + PointLabelOffset.x, p2.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p3",p3.m_x + PointLabelOffset.x, p3.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p4",mWireEnd.x + PointLabelOffset.x, mWireEnd.y + PointLabelOffset.y);
+    auto &wire = inputPin->GetWire();
+    wire.SetEnds(location, inputPin->GetAbsoluteLocation());
+    wire.Draw(gc);
 
+    if (mShowControlPoints)
+    {
+      wire.DrawControlPoints(gc, resources);
+      gc->SetPen(pen);
     }
   }
+}
 
-  for (auto inputPin : mCaught)
-  {
-    // Reset the pen for drawing draggable wires
-    gc->SetPen(wxPen(color, LineWidth));
-
-    auto inputPinLocation = inputPin->GetAbsoluteLocation();
+/**
+ * Get the area the pin and its wires are drawn in
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect OutputPin::GetBounds()
+{
+  const int locationX = mGate->GetX() + mLocation.x;
+  const int locationY = mGate->GetY() + mLocation.y;
 
-    double distance = sqrt(pow((locationX - inputPinLocation.x), 2) + pow((locationY - inputPinLocation.y), 2));
-    double offset = std::min(BezierMaxOffset, distance);
+  wxRect bounds(locationX - DefaultLineLength, locationY - PinSize / 2, DefaultLineLength + PinSize / 2, PinSize);
+  bounds.Inflate(LineWidth);
 
-    wxPoint2DDouble p1(locationX, locationY); // p1
-    wxPoint2DDouble p2(locationX + offset, locationY); // p2
-    wxPoint2DDouble p3(inputPinLocation.x - offset, inputPinLocation.y); // p3
+  if (mDragging)
+  {
+    bounds.Union(GetWireBounds(mWireEnd));
+  }
 
-    wxGraphicsPath path = gc->CreatePath();
+  auto game = mGate->GetGame();
+  for (auto caught : game->GetWires().GetFanout(mHandle))
+  {
+    bounds.Union(GetWireBounds(game->GetInputPinSlots().Get(caught)->GetAbsoluteLocation()));
+  }
 
-    path.MoveToPoint(p1);
-    path.AddCurveToPoint(p2, p3, inputPinLocation);
+  return bounds;
+}
 
-    gc->StrokePath(path);
+/**
+ * Get the area a wire from this pin is drawn in
+ * @param end Where the wire ends
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect OutputPin::GetWireBounds(wxPoint end) const
+{
+  return WirePath::GetBounds(GetAbsoluteLocation(), end, mShowControlPoints);
+}
 
-    if (mShowControlPoints)
-    {
-      // Draw the red pluses
-      gc->SetPen(*wxRED_PEN);
-
-      gc->StrokeLine(p1.m_x - PlusSize/2, p1.m_y, p1.m_x + PlusSize/2, p2.m_y);
-      gc->StrokeLine(p1.m_x, p1.m_y - PlusSize/2, p1.m_x, p2.m_y + PlusSize/2);
-
-      gc->StrokeLine(p2.m_x - PlusSize/2, p2.m_y, p2.m_x + PlusSize/2, p2.m_y);
-      gc->StrokeLine(p2.m_x, p2.m_y - PlusSize/2, p2.m_x, p2.m_y + PlusSize/2);
-
-      gc->StrokeLine(p3.m_x - PlusSize/2, p3.m_y, p3.m_x + PlusSize/2, p3.m_y);
-      gc->StrokeLine(p3.m_x, p3.m_y - PlusSize/2, p3.m_x, p3.m_y + PlusSize/2);
-
-      gc->StrokeLine(inputPinLocation.x - PlusSize/2, inputPinLocation.y, inputPinLocation.x + PlusSize/2, inputPinLocation.y);
-      gc->StrokeLine(inputPinLocation.x, inputPinLocation.y - PlusSize/2, inputPinLocation.x, inputPinLocation.y + PlusSize/2);
-
-      // Draw the green parallelogram
-      path = gc->CreatePath();
-      gc->SetPen(*wxGREEN_PEN);
-
-      path.MoveToPoint(p1.m_x, p1.m_y);
-      path.AddLineToPoint(p2.m_x, p2.m_y);
-      path.AddLineToPoint(inputPinLocation.x, inputPinLocation.y);
-      path.AddLineToPoint(p3.m_x, p3.m_y);
-      path.AddLineToPoint(p1.m_x, p1.m_y);
-      gc->StrokePath(path);
-
-      // Draw black labels for points p1, p2, p3, p3
-      gc->SetPen(*wxBLACK_PEN);
-      gc->DrawText(L"p1",p1.m_x + PointLabelOffset.x, p1.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p2",p2.m_x + PointLabelOffset.x, p2.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p3",p3.m_x + PointLabelOffset.x, p3.m_y + PointLabelOffset.y);
-      gc->DrawText(L"p4",inputPinLocation.x + PointLabelOffset.x, inputPinLocation.y + PointLabelOffset.y);
-    }
-  }
+/**
+ * Get the location of the output pin in pixels, not relative to the gate
+ * @return Location in pixels
+ */
+wxPoint OutputPin::GetAbsoluteLocation() const
+{
+  return wxPoint(mGate->GetX() + mLocation.x, mGate->GetY() + mLocation.y);
 }
 
 /**
@@ -200,8 +146,12 @@ void OutputPin::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
  */
 void OutputPin::SetLocation(double x, double y)
 {
+  auto game = mGate->GetGame();
+  game->Damage(GetBounds());
+
   mDragging = true;
   mWireEnd = wxPoint(int(x), int(y));
+  game->Damage(GetBounds());
 }
 
 /**
@@ -223,7 +173,7 @@ bool OutputPin::HitTest(int x, int y)
  */
 void OutputPin::MoveToFront()
 {
-  mGate->GetGame()->MoveToFront(mGate);
+  mGate->GetGame()->MoveToFront(mGate->GetHandle());
 }
 
 /**
@@ -231,34 +181,25 @@ void OutputPin::MoveToFront()
  */
 void OutputPin::Release()
 {
+  auto game = mGate->GetGame();
+  game->Damage(GetBounds());
+
   if(mDragging)
   {
     // The mouse has been released. See if there
     // is an input pin we can catch?
-    mGate->GetGame()->TryToCatch(this, mWireEnd);
+    game->TryToCatch(this, mWireEnd);
   }
 
   mDragging = false;
+  game->Damage(GetBounds());
 }
 
 /**
  * Set the caught input pin
  * @param caught Caught input pin
  */
-void OutputPin::SetCaught(InputPin *caught)
-{
-  mCaught.push_back(caught);
-  caught->SetInputLine(this);
-}
-
-/**
- * Remove the caught input pin
- * @param caught Caught input pin
- */
-void OutputPin::RemoveCaught(InputPin *caught)
-{
-  mCaught.erase(std::remove(mCaught.begin(), mCaught.end(), caught), mCaught.end());
-}
+void OutputPin::SetCaught(InputPin *caught) { caught->SetInputLine(this); }
 
 
 /**
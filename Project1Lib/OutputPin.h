@@ -10,16 +10,13 @@
 
 #include "States.h"
 #include "Item.h"
+#include "SlotTable.h"
+#include "WirePath.h"
+
 
 class InputPin;
 class Gate;
 
-/// Maximum offset of Bezier control points relative to line ends
-static constexpr double BezierMaxOffset = 200;
-
-/// Line width for drawing lines between pins
-static constexpr int LineWidth = 3;
-
 /// Default length of line from the pin
 static constexpr int DefaultLineLength = 20;
 
@@ -47,8 +44,11 @@ private:
   /// Are we dragging the line?
   bool mDragging = false;
 
-  /// List of input pin caught
-  std::vector<InputPin *> mCaught;
+  /// The wire being dragged
+  WirePath mDragWire;
+
+  /// Handle of this pin in the game
+  Handle mHandle;
 
   /// Show control points for this output pin?
   bool mShowControlPoints = false;
@@ -66,8 +66,17 @@ public:
   /// Constructor
   OutputPin(Gate *gate, wxPoint location, OutputPinTypes type = OutputPinTypes::Regular);
 
+  /// Destructor
+  ~OutputPin();
+
   void Draw(const std::shared_ptr<wxGraphicsContext> &gc);
 
+  wxRect GetBounds();
+
+  wxRect GetWireBounds(wxPoint end) const;
+
+  wxPoint GetAbsoluteLocation() const;
+
   void SetLocation(double x, double y) override;
 
   void MoveToFront() override;
@@ -78,12 +87,16 @@ public:
 
   void SetCaught(InputPin *caught);
 
-  void RemoveCaught(InputPin *caught);
-
   void SetControlPoints();
 
   void ResetControlPoints();
 
+  /**
+   * Get the handle of this pin in the game
+   * @return Handle
+   */
+  Handle GetHandle() const { return mHandle; }
+
   /**
    * Get the state for a gate
    * @return the state of the gate
@@ -0,0 +1,121 @@
+/**
+ * @file PerfectHash.h
+ * @author Nitish Maindoliya
+ *
+ * Name lookup tables built at compile time.
+ */
+
+#ifndef PERFECTHASH_H
+#define PERFECTHASH_H
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * Table that finds the index of a name in a fixed list of names.
+ *
+ * The table is built at compile time with a seed for which every
+ * name hashes to its own slot, so a lookup is one hash and one
+ * string compare.
+ * @tparam N Number of names
+ */
+template <size_t N>
+class PerfectHash
+{
+public:
+  /// Number of slots, a power of two at least twice the number of names
+  static constexpr size_t TableSize = [] {
+    size_t size = 1;
+    while (size < 2 * N)
+    {
+      size *= 2;
+    }
+    return size;
+  }();
+
+private:
+  /// The names
+  std::array<std::wstring_view, N> mNames{};
+
+  /// Index of the name in each slot, or -1 if empty
+  std::array<int, TableSize> mSlots{};
+
+  /// Seed for which the names do not collide
+  uint32_t mSeed = 0;
+
+  /**
+   * Hash a name
+   * @param name The name
+   * @param seed Seed for the hash
+   * @return Slot for the name
+   */
+  static constexpr size_t Hash(std::wstring_view name, uint32_t seed)
+  {
+    // FNV-1a
+    uint32_t hash = 2166136261u ^ seed;
+    for (auto c : name)
+    {
+      hash = (hash ^ uint32_t(c)) * 16777619u;
+    }
+
+    return hash & (TableSize - 1);
+  }
+
+  /**
+   * Try to place every name with a seed
+   * @param seed The seed
+   * @return True if no two names share a slot
+   */
+  constexpr bool TrySeed(uint32_t seed)
+  {
+    for (auto &slot : mSlots)
+    {
+      slot = -1;
+    }
+
+    for (size_t i = 0; i < N; i++)
+    {
+      auto &slot = mSlots[Hash(mNames[i], seed)];
+      if (slot >= 0)
+      {
+        return false;
+      }
+
+      slot = int(i);
+    }
+
+    mSeed = seed;
+    return true;
+  }
+
+public:
+  /**
+   * Constructor
+   * @param names The names to look up. They must be different.
+   */
+  constexpr explicit PerfectHash(const std::array<std::wstring_view, N> &names) : mNames(names)
+  {
+    for (uint32_t seed = 0; !TrySeed(seed); seed++)
+    {
+      if (seed > 10000)
+      {
+        throw std::logic_error("no perfect hash seed");
+      }
+    }
+  }
+
+  /**
+   * Find a name
+   * @param name The name
+   * @return Index of the name in the list, or -1 if it is not there
+   */
+  constexpr int Find(std::wstring_view name) const
+  {
+    const int index = mSlots[Hash(name, mSeed)];
+    return index >= 0 && mNames[size_t(index)] == name ? index : -1;
+  }
+};
+
+#endif // PERFECTHASH_H
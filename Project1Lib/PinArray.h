@@ -0,0 +1,82 @@
+/**
+ * @file PinArray.h
+ * @author Nitish Maindoliya
+ *
+ * Fixed-capacity storage for the pins of a gate.
+ */
+
+#ifndef PINARRAY_H
+#define PINARRAY_H
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include "Span.h"
+
+/**
+ * Pins stored inline in the gate that owns them.
+ *
+ * Pins register their own address in the game's slot tables,
+ * so once made they never move. The array only grows.
+ * @tparam Pin InputPin or OutputPin
+ * @tparam Capacity Most pins the array can hold
+ */
+template <class Pin, size_t Capacity>
+class PinArray
+{
+private:
+  /// Storage for the pins
+  alignas(Pin) std::byte mStorage[sizeof(Pin) * Capacity];
+
+  /// Number of pins made
+  size_t mSize = 0;
+
+  /**
+   * Get the first pin
+   * @return Pointer to the first pin
+   */
+  Pin *Data() { return std::launder(reinterpret_cast<Pin *>(mStorage)); }
+
+public:
+  /// Constructor
+  PinArray() = default;
+
+  /// Copy constructor (disabled)
+  PinArray(const PinArray &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const PinArray &) = delete;
+
+  /// Destructor, destroys the pins last made first
+  ~PinArray()
+  {
+    for (size_t i = mSize; i > 0; i--)
+    {
+      Data()[i - 1].~Pin();
+    }
+  }
+
+  /**
+   * Make a new pin at the end of the array
+   * @param args Arguments for the pin constructor
+   * @return The new pin
+   */
+  template <class... Args>
+  Pin &Emplace(Args &&...args)
+  {
+    assert(mSize < Capacity);
+    auto pin = new (mStorage + sizeof(Pin) * mSize) Pin(std::forward<Args>(args)...);
+    mSize++;
+    return *pin;
+  }
+
+  /**
+   * Get a view of the pins
+   * @return Span of the pins
+   */
+  Span<Pin> GetSpan() { return Span<Pin>(Data(), mSize); }
+};
+
+#endif // PINARRAY_H
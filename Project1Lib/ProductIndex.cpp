@@ -0,0 +1,36 @@
+/**
+ * @file ProductIndex.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "ProductIndex.h"
+
+#include "Items/Product.h"
+
+/**
+ * Remove a product from the index.
+ *
+ * Used when a product stops moving with the belt, like when it is kicked.
+ * @param product The product to remove
+ */
+void ProductIndex::Remove(Product *product)
+{
+  mProducts.erase(std::remove(mProducts.begin(), mProducts.end(), product), mProducts.end());
+}
+
+/**
+ * Find the products strictly between two Y locations
+ * @param minY Lower Y bound (exclusive)
+ * @param maxY Upper Y bound (exclusive)
+ * @return Range of products, sorted by increasing Y
+ */
+ProductIndex::Range ProductIndex::Query(double minY, double maxY) const
+{
+  auto first = std::upper_bound(mProducts.begin(), mProducts.end(), minY,
+                                [](double y, const Product *product) { return y < product->GetY(); });
+  auto last = std::lower_bound(first, mProducts.end(), maxY,
+                               [](const Product *product, double y) { return product->GetY() < y; });
+
+  return Range(first, last);
+}
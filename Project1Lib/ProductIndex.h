@@ -0,0 +1,112 @@
+/**
+ * @file ProductIndex.h
+ * @author Nitish Maindoliya
+ *
+ * Index of the products on a conveyor, ordered by Y location.
+ */
+
+#ifndef PRODUCTINDEX_H
+#define PRODUCTINDEX_H
+
+#include <cassert>
+#include <deque>
+
+class Product;
+
+/**
+ * Index of the displayed products on a conveyor belt.
+ *
+ * Every product on the belt moves at the same speed, so once
+ * the products are sorted by Y the order never changes. That
+ * lets us answer "which products are between these two Y
+ * values" with a binary search instead of visiting every item.
+ */
+class ProductIndex
+{
+public:
+  /// Iterator over the products in the index
+  using Iterator = std::deque<Product *>::const_iterator;
+
+  /**
+   * A range of products returned by a query
+   */
+  class Range
+  {
+  private:
+    /// First product in the range
+    Iterator mBegin;
+    /// One past the last product in the range
+    Iterator mEnd;
+
+  public:
+    /**
+     * Constructor
+     * @param begin First product in the range
+     * @param end One past the last product in the range
+     */
+    Range(Iterator begin, Iterator end) : mBegin(begin), mEnd(end) {}
+
+    /**
+     * Get the beginning of the range
+     * @return Begin iterator
+     */
+    Iterator begin() const { return mBegin; }
+
+    /**
+     * Get the end of the range
+     * @return End iterator
+     */
+    Iterator end() const { return mEnd; }
+
+    /**
+     * Is the range empty?
+     * @return True if there are no products in the range
+     */
+    bool empty() const { return mBegin == mEnd; }
+  };
+
+private:
+  /// The products, sorted by increasing Y location
+  std::deque<Product *> mProducts;
+
+public:
+  /**
+   * Add a product above every product in the index.
+   *
+   * New products come onto the belt at the top, so they go
+   * at the front without any searching.
+   * @param product The product to add
+   */
+  void AddTop(Product *product) { mProducts.push_front(product); }
+
+  void Remove(Product *product);
+
+  /**
+   * Remove the lowest product in the index.
+   *
+   * Products go off the bottom of the game in the order they are
+   * on the belt, so the one leaving is always the last one.
+   * @param product The product to remove, which must be the lowest
+   */
+  void RemoveBottom(Product *product)
+  {
+    assert(!mProducts.empty() && mProducts.back() == product);
+    mProducts.pop_back();
+  }
+
+  Range Query(double minY, double maxY) const;
+
+  /**
+   * Remove all products from the index
+   */
+  void Clear() { mProducts.clear(); }
+
+  /**
+   * Get the number of products in the index
+   * @return Number of products
+   */
+  size_t GetSize() const { return mProducts.size(); }
+};
+
+
+#endif // PRODUCTINDEX_H
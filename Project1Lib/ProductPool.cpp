@@ -0,0 +1,51 @@
+/**
+ * @file ProductPool.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "ProductPool.h"
+
+/**
+ * Add a product to the pool
+ * @param placement Distance the product starts above the conveyor
+ * @param properties Packed shape, color and content
+ * @param flags Initial flags
+ * @return Slot of the new product
+ */
+size_t ProductPool::Add(double placement, uint16_t properties, uint8_t flags)
+{
+  mPlacements.push_back(placement);
+  mKickTimes.push_back(0);
+  mKickClocks.push_back(0);
+  mFlags.push_back(flags);
+  mProperties.push_back(properties);
+  return mFlags.size() - 1;
+}
+
+/**
+ * Compute the conveyor time some products reach a Y location.
+ *
+ * A product at conveyor time t is at startY - placement + speed * t.
+ * @param y Y location in virtual pixels
+ * @param startY Y location of the conveyor
+ * @param speed Conveyor speed in pixels per second
+ * @param slots Slots of the products
+ * @param times Set to the time for each of the slots, in the same order
+ */
+void ProductPool::CrossingTimes(double y, double startY, double speed, const std::vector<size_t> &slots,
+                                std::vector<double> &times) const
+{
+  const size_t size = slots.size();
+  times.resize(size);
+
+  const double offset = y - startY;
+  const double inverseSpeed = 1.0 / speed;
+  const double *placements = mPlacements.data();
+  const size_t *in = slots.data();
+  double *out = times.data();
+  for (size_t i = 0; i < size; i++)
+  {
+    out[i] = (offset + placements[in[i]]) * inverseSpeed;
+  }
+}
@@ -0,0 +1,162 @@
+/**
+ * @file ProductPool.h
+ * @author Nitish Maindoliya
+ *
+ * Structure-of-arrays storage for product state.
+ */
+
+#ifndef PRODUCTPOOL_H
+#define PRODUCTPOOL_H
+
+#include <cstdint>
+#include <vector>
+
+class Conveyor;
+
+/**
+ * Storage for the state of a group of products.
+ *
+ * Each product is a slot in a set of parallel arrays rather than
+ * a separate object, so passes over every product on a conveyor
+ * walk contiguous memory and are simple enough for the compiler
+ * to vectorize. Product objects are handles to a slot.
+ */
+class ProductPool
+{
+public:
+  /// Bits in the flags of a product
+  enum Flags : uint8_t
+  {
+    MovingLeft = 1 << 0,
+    BeamHit = 1 << 1,
+    Kick = 1 << 2,
+    Resolved = 1 << 3
+  };
+
+private:
+  /// The conveyor the products ride on, or nullptr if they are not on one
+  Conveyor *mConveyor = nullptr;
+
+  /// Distance each product starts above the conveyor
+  std::vector<double> mPlacements;
+
+  /// Conveyor time each product was kicked
+  std::vector<double> mKickTimes;
+
+  /// Kick clock time each product was kicked
+  std::vector<double> mKickClocks;
+
+  /// Flags for each product
+  std::vector<uint8_t> mFlags;
+
+  /// Packed shape, color and content of each product
+  std::vector<uint16_t> mProperties;
+
+public:
+  /**
+   * Constructor
+   * @param conveyor The conveyor the products ride on, or nullptr
+   */
+  explicit ProductPool(Conveyor *conveyor = nullptr) : mConveyor(conveyor) {}
+
+  /// Copy constructor (disabled)
+  ProductPool(const ProductPool &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const ProductPool &) = delete;
+
+  size_t Add(double placement, uint16_t properties, uint8_t flags);
+
+  void CrossingTimes(double y, double startY, double speed, const std::vector<size_t> &slots,
+                     std::vector<double> &times) const;
+
+  /**
+   * Get the conveyor the products ride on
+   * @return Conveyor or nullptr
+   */
+  Conveyor *GetConveyor() const { return mConveyor; }
+
+  /**
+   * Get the number of slots in the pool
+   * @return Number of slots
+   */
+  size_t GetSize() const { return mFlags.size(); }
+
+  /**
+   * Get the placement of a product
+   * @param slot Product slot
+   * @return Distance the product starts above the conveyor
+   */
+  double GetPlacement(size_t slot) const { return mPlacements[slot]; }
+
+  /**
+   * Set the placement of a product
+   * @param slot Product slot
+   * @param placement Distance the product starts above the conveyor
+   */
+  void SetPlacement(size_t slot, double placement) { mPlacements[slot] = placement; }
+
+  /**
+   * Get the conveyor time a product was kicked
+   * @param slot Product slot
+   * @return Kick time in seconds
+   */
+  double GetKickTime(size_t slot) const { return mKickTimes[slot]; }
+
+  /**
+   * Set the conveyor time a product was kicked
+   * @param slot Product slot
+   * @param time Kick time in seconds
+   */
+  void SetKickTime(size_t slot, double time) { mKickTimes[slot] = time; }
+
+  /**
+   * Get the kick clock time a product was kicked
+   * @param slot Product slot
+   * @return Kick clock time in seconds
+   */
+  double GetKickClock(size_t slot) const { return mKickClocks[slot]; }
+
+  /**
+   * Set the kick clock time a product was kicked
+   * @param slot Product slot
+   * @param time Kick clock time in seconds
+   */
+  void SetKickClock(size_t slot, double time) { mKickClocks[slot] = time; }
+
+  /**
+   * Get the packed properties of a product
+   * @param slot Product slot
+   * @return Packed shape, color and content
+   */
+  uint16_t GetProperties(size_t slot) const { return mProperties[slot]; }
+
+  /**
+   * Set the packed properties of a product
+   * @param slot Product slot
+   * @param properties Packed shape, color and content
+   */
+  void SetProperties(size_t slot, uint16_t properties) { mProperties[slot] = properties; }
+
+  /**
+   * Test a flag of a product
+   * @param slot Product slot
+   * @param flag Flag to test
+   * @return True if the flag is set
+   */
+  bool HasFlag(size_t slot, Flags flag) const { return (mFlags[slot] & flag) != 0; }
+
+  /**
+   * Set or clear a flag of a product
+   * @param slot Product slot
+   * @param flag Flag to change
+   * @param set True to set the flag, false to clear it
+   */
+  void SetFlag(size_t slot, Flags flag, bool set)
+  {
+    mFlags[slot] = set ? mFlags[slot] | flag : mFlags[slot] & ~flag;
+  }
+};
+
+
+#endif // PRODUCTPOOL_H
@@ -0,0 +1,72 @@
+/**
+ * @file ProductionLine.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "ProductionLine.h"
+
+#include "Items/Conveyor.h"
+
+/**
+ * Move the products on this line.
+ *
+ * This only touches the line's own conveyor, products and beam,
+ * so lines can be updated at the same time on different threads.
+ * Scores are queued until ApplyOutcomes.
+ * @param elapsed The time since the last update
+ */
+void ProductionLine::Update(double elapsed)
+{
+  if (mConveyor != nullptr)
+  {
+    mConveyor->Advance(elapsed);
+  }
+}
+
+/**
+ * Record a product leaving the beam
+ * @param correct True if the product was handled correctly
+ */
+void ProductionLine::ProductScored(bool correct)
+{
+  mOutcomes.push_back(correct);
+}
+
+/**
+ * Is this line done with its products?
+ *
+ * A line with no conveyor has nothing to do.
+ * @return True if every product on the conveyor has been resolved
+ */
+bool ProductionLine::IsFinished() const
+{
+  return mConveyor == nullptr || mConveyor->IsFinished();
+}
+
+/**
+ * Add the scores recorded since the last call to the line's tally
+ */
+void ProductionLine::ApplyOutcomes()
+{
+  for (bool correct : mOutcomes)
+  {
+    mLedger.push_back(correct);
+    mCorrectCount += correct;
+  }
+
+  mOutcomes.clear();
+}
+
+/**
+ * Forget the scores of a previous run of the conveyor.
+ *
+ * The level score is the sum of the lines' tallies, so this
+ * takes the line's part back out of it.
+ */
+void ProductionLine::Reset()
+{
+  mOutcomes.clear();
+  mLedger.clear();
+  mCorrectCount = 0;
+}
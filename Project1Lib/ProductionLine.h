@@ -0,0 +1,139 @@
+/**
+ * @file ProductionLine.h
+ * @author Nitish Maindoliya
+ *
+ * A conveyor with its own sensor, beam and Sparty.
+ */
+
+#ifndef PRODUCTIONLINE_H
+#define PRODUCTIONLINE_H
+
+#include <vector>
+
+class Conveyor;
+class Sensor;
+class Beam;
+class Sparty;
+
+/**
+ * A production line: a conveyor and the sensor, beam and
+ * Sparty that work on its products.
+ *
+ * A level can have several lines. The items stay in the game
+ * so they are drawn and visited like any other item, but each
+ * knows its line and only looks at the products of its own
+ * conveyor. That lets the lines update independently.
+ */
+class ProductionLine
+{
+private:
+  /// The conveyor for this line
+  Conveyor *mConveyor = nullptr;
+
+  /// The sensor for this line
+  Sensor *mSensor = nullptr;
+
+  /// The beam for this line
+  Beam *mBeam = nullptr;
+
+  /// The Sparty that kicks products off this line
+  Sparty *mSparty = nullptr;
+
+  /// Scores for products that have left the beam, true if handled correctly.
+  /// These are applied to the tally between updates.
+  std::vector<bool> mOutcomes;
+
+  /// Outcome of each product scored since the conveyor last started, in order
+  std::vector<bool> mLedger;
+
+  /// Number of correct outcomes in the ledger
+  int mCorrectCount = 0;
+
+public:
+  /// Constructor
+  ProductionLine() = default;
+
+  /// Copy constructor (disabled)
+  ProductionLine(const ProductionLine &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const ProductionLine &) = delete;
+
+  void Update(double elapsed);
+
+  void ProductScored(bool correct);
+
+  void ApplyOutcomes();
+
+  void Reset();
+
+  bool IsFinished() const;
+
+  /**
+   * Get the outcomes of the products scored since the conveyor last started
+   * @return Ledger of outcomes, true for each correct one
+   */
+  const std::vector<bool> &GetLedger() const { return mLedger; }
+
+  /**
+   * Get the number of products handled correctly on this line
+   * @return Number of correct outcomes
+   */
+  int GetCorrectCount() const { return mCorrectCount; }
+
+  /**
+   * Get the number of products handled incorrectly on this line
+   * @return Number of incorrect outcomes
+   */
+  int GetIncorrectCount() const { return int(mLedger.size()) - mCorrectCount; }
+
+  /**
+   * Get the conveyor for this line
+   * @return Conveyor or nullptr
+   */
+  Conveyor *GetConveyor() const { return mConveyor; }
+
+  /**
+   * Set the conveyor for this line
+   * @param conveyor The conveyor
+   */
+  void SetConveyor(Conveyor *conveyor) { mConveyor = conveyor; }
+
+  /**
+   * Get the sensor for this line
+   * @return Sensor or nullptr
+   */
+  Sensor *GetSensor() const { return mSensor; }
+
+  /**
+   * Set the sensor for this line
+   * @param sensor The sensor
+   */
+  void SetSensor(Sensor *sensor) { mSensor = sensor; }
+
+  /**
+   * Get the beam for this line
+   * @return Beam or nullptr
+   */
+  Beam *GetBeam() const { return mBeam; }
+
+  /**
+   * Set the beam for this line
+   * @param beam The beam
+   */
+  void SetBeam(Beam *beam) { mBeam = beam; }
+
+  /**
+   * Get the Sparty for this line
+   * @return Sparty or nullptr
+   */
+  Sparty *GetSparty() const { return mSparty; }
+
+  /**
+   * Set the Sparty for this line
+   * @param sparty The Sparty
+   */
+  void SetSparty(Sparty *sparty) { mSparty = sparty; }
+};
+
+#endif // PRODUCTIONLINE_H
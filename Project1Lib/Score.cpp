@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "Score.h"
+#include "IScoreObserver.h"
 
 /**
  * Constructor
@@ -13,16 +14,25 @@ Score::Score() {}
 
 
 /**
- * Update the score
- * @param isCorrect bool based on product kicking
+ * Set the outcomes of the products scored this level.
+ *
+ * The level score is worked out from the number of products
+ * handled correctly and incorrectly on all of the lines.
+ * Observers are only told if the score changed.
+ * @param correct Number of products handled correctly
+ * @param incorrect Number of products handled incorrectly
  */
-void Score::UpdateLevelScore(bool isCorrect)
+void Score::SetLevelOutcomes(int correct, int incorrect)
 {
-  if (isCorrect) {
-    mLevelScore += mGood;  // Correct kick
-  } else {
-    mLevelScore += mBad;   // Incorrect kick
+  if (correct == mCorrectCount && incorrect == mIncorrectCount)
+  {
+    return;
   }
+
+  mCorrectCount = correct;
+  mIncorrectCount = incorrect;
+  mLevelScore = correct * mGood + incorrect * mBad;
+  Notify();
 }
 
 /**
@@ -33,6 +43,9 @@ void Score::EndLevel()
 {
   mGameScore += mLevelScore;  // Add the level score to the total game score
   mLevelScore = 0;            // Reset the level score
+  mCorrectCount = 0;
+  mIncorrectCount = 0;
+  Notify();
 }
 
 /**
@@ -41,4 +54,45 @@ void Score::EndLevel()
 void Score::Reset()
 {
   mLevelScore = 0;
+  mCorrectCount = 0;
+  mIncorrectCount = 0;
+  Notify();
+}
+
+/**
+ * Resets the level and game score
+ */
+void Score::HardReset()
+{
+  mGameScore = 0;
+  Reset();
+}
+
+/**
+ * Add an observer that is told when the score changes
+ * @param observer The observer to add
+ */
+void Score::AddObserver(IScoreObserver *observer)
+{
+  mObservers.push_back(observer);
+}
+
+/**
+ * Remove an observer
+ * @param observer The observer to remove
+ */
+void Score::RemoveObserver(IScoreObserver *observer)
+{
+  mObservers.erase(std::remove(mObservers.begin(), mObservers.end(), observer), mObservers.end());
+}
+
+/**
+ * Tell all of the observers the score has changed
+ */
+void Score::Notify()
+{
+  for (auto observer : mObservers)
+  {
+    observer->ScoreChanged(this);
+  }
 }
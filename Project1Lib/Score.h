@@ -10,6 +10,10 @@
 
 #include "Visitors/ItemVisitor.h"
 
+#include <vector>
+
+class IScoreObserver;
+
 /**
  *
  * Class for Score
@@ -27,6 +31,16 @@ private:
   /// Points for an incorrect kick
   int mBad = -5;
 
+  /// Number of products handled correctly this level
+  int mCorrectCount = 0;
+  /// Number of products handled incorrectly this level
+  int mIncorrectCount = 0;
+
+  /// Everything that is told when the score changes
+  std::vector<IScoreObserver *> mObservers;
+
+  void Notify();
+
 public:
   /// Default constructor
   Score();
@@ -43,7 +57,7 @@ public:
    */
   void SetBadScore(int bad) { mBad = bad; }
 
-  void UpdateLevelScore(bool isCorrect);
+  void SetLevelOutcomes(int correct, int incorrect);
 
   void EndLevel();
 
@@ -59,17 +73,25 @@ public:
    */
   int GetGameScore() const { return mGameScore; }
 
-
-  void Reset();
+  /**
+   * Get the number of products handled correctly this level
+   * @return Number of correct outcomes
+   */
+  int GetCorrectCount() const { return mCorrectCount; }
 
   /**
-   * Resets the level and game score
+   * Get the number of products handled incorrectly this level
+   * @return Number of incorrect outcomes
    */
-  void HardReset()
-  {
-    mLevelScore = 0;
-    mGameScore = 0;
-  }
+  int GetIncorrectCount() const { return mIncorrectCount; }
+
+  void Reset();
+
+  void HardReset();
+
+  void AddObserver(IScoreObserver *observer);
+
+  void RemoveObserver(IScoreObserver *observer);
 };
 
 #endif // SCORE_H
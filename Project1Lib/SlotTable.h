@@ -0,0 +1,183 @@
+/**
+ * @file SlotTable.h
+ * @author Nitish Maindoliya
+ *
+ * Generational handles and the tables that resolve them.
+ */
+
+#ifndef SLOTTABLE_H
+#define SLOTTABLE_H
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/**
+ * A compact reference to an object in a SlotTable.
+ *
+ * The low bits are the index of the slot and the high bits are
+ * the generation of the slot when the handle was made. When the
+ * object is removed its slot moves on to the next generation, so
+ * old handles to it stop resolving instead of dangling.
+ */
+class Handle
+{
+public:
+  /// Number of bits for the slot index
+  static constexpr int IndexBits = 24;
+
+  /// Mask for the slot index
+  static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+
+  /// Largest generation. Generation 0 is never used, so a zero handle is null.
+  static constexpr uint32_t MaxGeneration = (1u << (32 - IndexBits)) - 1;
+
+private:
+  /// Generation and index packed together
+  uint32_t mValue = 0;
+
+public:
+  /// Constructor for a null handle
+  Handle() = default;
+
+  /**
+   * Constructor
+   * @param index Index of the slot
+   * @param generation Generation of the slot
+   */
+  Handle(uint32_t index, uint32_t generation) : mValue(generation << IndexBits | index) {}
+
+  /**
+   * Get the index of the slot
+   * @return Slot index
+   */
+  uint32_t GetIndex() const { return mValue & IndexMask; }
+
+  /**
+   * Get the generation of the slot when the handle was made
+   * @return Generation
+   */
+  uint32_t GetGeneration() const { return mValue >> IndexBits; }
+
+  /**
+   * Is this the null handle?
+   * @return True if null
+   */
+  bool IsNull() const { return mValue == 0; }
+
+  /**
+   * Compare handles
+   * @param other Handle to compare to
+   * @return True if they are the same handle
+   */
+  bool operator==(Handle other) const { return mValue == other.mValue; }
+
+  /**
+   * Compare handles
+   * @param other Handle to compare to
+   * @return True if they are different handles
+   */
+  bool operator!=(Handle other) const { return mValue != other.mValue; }
+};
+
+/**
+ * Table that hands out handles for objects and resolves them.
+ *
+ * The table does not own the objects. Removing an object frees
+ * its slot for reuse and makes every handle to it stale.
+ * @tparam T Type of the objects
+ */
+template <class T>
+class SlotTable
+{
+private:
+  /// A slot in the table
+  struct Slot
+  {
+    /// The object in the slot or nullptr if free
+    T *mObject = nullptr;
+
+    /// Generation of the slot
+    uint32_t mGeneration = 1;
+  };
+
+  /// The slots
+  std::vector<Slot> mSlots;
+
+  /// Indices of the free slots
+  std::vector<uint32_t> mFree;
+
+  /// Number of objects in the table
+  size_t mCount = 0;
+
+public:
+  /**
+   * Put an object in the table
+   * @param object The object
+   * @return Handle for the object
+   */
+  Handle Insert(T *object)
+  {
+    uint32_t index;
+    if (!mFree.empty())
+    {
+      index = mFree.back();
+      mFree.pop_back();
+    }
+    else
+    {
+      assert(mSlots.size() <= Handle::IndexMask);
+      index = uint32_t(mSlots.size());
+      mSlots.emplace_back();
+    }
+
+    auto &slot = mSlots[index];
+    slot.mObject = object;
+    mCount++;
+    return Handle(index, slot.mGeneration);
+  }
+
+  /**
+   * Take an object out of the table.
+   *
+   * Removing with a stale or null handle does nothing.
+   * @param handle Handle for the object
+   */
+  void Remove(Handle handle)
+  {
+    if (Get(handle) == nullptr)
+    {
+      return;
+    }
+
+    auto &slot = mSlots[handle.GetIndex()];
+    slot.mObject = nullptr;
+    slot.mGeneration = slot.mGeneration % Handle::MaxGeneration + 1;
+    mFree.push_back(handle.GetIndex());
+    mCount--;
+  }
+
+  /**
+   * Resolve a handle
+   * @param handle The handle
+   * @return The object or nullptr if the handle is null or stale
+   */
+  T *Get(Handle handle) const
+  {
+    if (handle.IsNull() || handle.GetIndex() >= mSlots.size())
+    {
+      return nullptr;
+    }
+
+    const auto &slot = mSlots[handle.GetIndex()];
+    return slot.mGeneration == handle.GetGeneration() ? slot.mObject : nullptr;
+  }
+
+  /**
+   * Get the number of objects in the table
+   * @return Number of objects
+   */
+  size_t GetCount() const { return mCount; }
+};
+
+#endif // SLOTTABLE_H
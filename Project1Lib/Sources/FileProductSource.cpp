@@ -0,0 +1,82 @@
+/**
+ * @file FileProductSource.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "../pch.h"
+#include "FileProductSource.h"
+
+#include <sstream>
+
+/**
+ * Constructor
+ * @param filename Name of the file to read
+ */
+FileProductSource::FileProductSource(const std::wstring &filename) : mFile(wxString(filename).ToStdString())
+{
+  Rewind();
+}
+
+/**
+ * Go back to the start of the file
+ */
+void FileProductSource::Rewind()
+{
+  mFile.clear();
+  mFile.seekg(0);
+  mLastPlacement = 0;
+}
+
+/**
+ * Read the next product from the file
+ * @param spec Set to the next product if there is one
+ * @return False at the end of the file
+ */
+bool FileProductSource::Next(ProductSpec &spec)
+{
+  std::wstring line;
+  while (std::getline(mFile, line))
+  {
+    std::wstringstream stream(line);
+    std::wstring placement, shape, color, content = L"none", kick = L"no";
+    if (!(stream >> placement) || placement[0] == L'#' || !(stream >> shape >> color))
+    {
+      continue;
+    }
+
+    stream >> content >> kick;
+
+    // A line with no content can have the kick in its place
+    if (content == L"yes" || content == L"no")
+    {
+      kick = content;
+      content = L"none";
+    }
+
+    auto shapeProperty = Product::FindProperty(shape);
+    auto colorProperty = Product::FindProperty(color);
+    auto contentProperty = Product::FindProperty(content);
+    if (!shapeProperty || !colorProperty || !contentProperty)
+    {
+      continue;
+    }
+
+    // The file is streamed, so it can't be sorted. A product placed
+    // before the last one would be out of order on the belt.
+    const double productPlacement = ParsePlacement(placement, mLastPlacement);
+    if (productPlacement < mLastPlacement)
+    {
+      continue;
+    }
+
+    spec.mPlacement = productPlacement;
+    spec.mShape = *shapeProperty;
+    spec.mColor = *colorProperty;
+    spec.mContent = *contentProperty;
+    spec.mKick = kick == L"yes";
+    mLastPlacement = spec.mPlacement;
+    return true;
+  }
+
+  return false;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file FileProductSource.h
+ * @author Nitish Maindoliya
+ */
+
+#ifndef FILEPRODUCTSOURCE_H
+#define FILEPRODUCTSOURCE_H
+
+#include "ProductSource.h"
+
+#include <fstream>
+
+/**
+ * Product source that reads products from a text file as they
+ * are needed.
+ *
+ * Each line is one product:
+ *
+ *     placement shape color [content] [kick]
+ *
+ * using the same names and placement rules as the level files,
+ * for example "+150 circle red izzo yes". Lines starting with #
+ * are ignored, and so are products placed before the product on
+ * the line before them, since the file is read as the products
+ * are needed and can't be sorted.
+ */
+class FileProductSource : public ProductSource
+{
+private:
+  /// The file
+  std::wifstream mFile;
+
+  /// Placement of the last product read
+  double mLastPlacement = 0;
+
+public:
+  /// Default constructor (disabled)
+  FileProductSource() = delete;
+
+  explicit FileProductSource(const std::wstring &filename);
+
+  bool Next(ProductSpec &spec) override;
+
+  void Rewind() override;
+};
+
+#endif // FILEPRODUCTSOURCE_H
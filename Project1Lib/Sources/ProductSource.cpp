@@ -0,0 +1,30 @@
+/**
+ * @file ProductSource.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "../pch.h"
+#include "ProductSource.h"
+
+#include <sstream>
+
+/**
+ * Parse a product placement.
+ *
+ * A placement that starts with + is relative to the last placement.
+ * @param placement The placement string
+ * @param lastPlacement Placement of the previous product
+ * @return The placement
+ */
+double ProductSource::ParsePlacement(const std::wstring &placement, double lastPlacement)
+{
+  double value = 0;
+  if (!placement.empty() && placement[0] == L'+')
+  {
+    std::wstringstream(placement.substr(1)) >> value;
+    return lastPlacement + value;
+  }
+
+  std::wstringstream(placement) >> value;
+  return value;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file ProductSource.h
+ * @author Nitish Maindoliya
+ *
+ * Base class for the sources of products on a conveyor.
+ */
+
+#ifndef PRODUCTSOURCE_H
+#define PRODUCTSOURCE_H
+
+#include "../Items/Product.h"
+
+/**
+ * Description of a product to put on a conveyor
+ */
+struct ProductSpec
+{
+  /// Distance the product starts above the conveyor
+  double mPlacement = 0;
+  /// The shape of the product
+  Product::Properties mShape = Product::Properties::Square;
+  /// The color of the product
+  Product::Properties mColor = Product::Properties::Red;
+  /// The content of the product
+  Product::Properties mContent = Product::Properties::None;
+  /// Whether the product should be kicked off the conveyor
+  bool mKick = false;
+};
+
+/**
+ * Base class for a stream of products for a conveyor.
+ *
+ * The conveyor asks for the next product just before it comes
+ * into view, so a source never has to hold a whole level of
+ * products at once. Products come out in increasing placement.
+ */
+class ProductSource
+{
+public:
+  /// Destructor
+  virtual ~ProductSource() = default;
+
+  /**
+   * Get the next product
+   * @param spec Set to the next product if there is one
+   * @return False if the source has run out of products
+   */
+  virtual bool Next(ProductSpec &spec) = 0;
+
+  /**
+   * Go back to the first product
+   */
+  virtual void Rewind() = 0;
+
+  static double ParsePlacement(const std::wstring &placement, double lastPlacement);
+};
+
+#endif // PRODUCTSOURCE_H
@@ -0,0 +1,88 @@
+/**
+ * @file RandomProductSource.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "../pch.h"
+#include "RandomProductSource.h"
+
+/**
+ * Constructor
+ * @param seed Seed for the random number generator
+ * @param count Number of products to make, or 0 for no limit
+ * @param spacing Distance between products in pixels
+ * @param shapes Choices for the shape
+ * @param colors Choices for the color
+ * @param contents Choices for the content
+ * @param kick Products with any of these properties should be kicked
+ */
+RandomProductSource::RandomProductSource(unsigned seed, long count, double spacing, Choices shapes, Choices colors,
+                                         Choices contents, std::set<Product::Properties> kick) :
+    mSeed(seed), mCount(count), mSpacing(spacing), mShapes(std::move(shapes)), mColors(std::move(colors)),
+    mContents(std::move(contents)), mKick(std::move(kick)), mRandom(seed)
+{
+}
+
+/**
+ * Get the next product
+ * @param spec Set to the next product if there is one
+ * @return False if the source has run out of products
+ */
+bool RandomProductSource::Next(ProductSpec &spec)
+{
+  if (mCount > 0 && mMade >= mCount)
+  {
+    return false;
+  }
+
+  mMade++;
+
+  spec.mPlacement = mSpacing * mMade;
+  spec.mShape = Pick(mShapes);
+  spec.mColor = Pick(mColors);
+  spec.mContent = Pick(mContents);
+  spec.mKick = mKick.count(spec.mShape) || mKick.count(spec.mColor) || mKick.count(spec.mContent);
+  return true;
+}
+
+/**
+ * Go back to the first product.
+ *
+ * Reseeding gives the same products again.
+ */
+void RandomProductSource::Rewind()
+{
+  mRandom.seed(mSeed);
+  mMade = 0;
+}
+
+/**
+ * Pick one of a list of weighted choices
+ * @param choices The choices
+ * @return The property picked
+ */
+Product::Properties RandomProductSource::Pick(const Choices &choices)
+{
+  if (choices.empty())
+  {
+    return Product::Properties::None;
+  }
+
+  double total = 0;
+  for (const auto &choice : choices)
+  {
+    total += choice.second;
+  }
+
+  double pick = std::uniform_real_distribution<double>(0, total)(mRandom);
+  for (const auto &choice : choices)
+  {
+    pick -= choice.second;
+    if (pick < 0)
+    {
+      return choice.first;
+    }
+  }
+
+  return choices.back().first;
+}
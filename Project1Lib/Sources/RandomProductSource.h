@@ -0,0 +1,68 @@
+/**
+ * @file RandomProductSource.h
+ * @author Nitish Maindoliya
+ */
+
+#ifndef RANDOMPRODUCTSOURCE_H
+#define RANDOMPRODUCTSOURCE_H
+
+#include "ProductSource.h"
+
+#include <random>
+#include <set>
+#include <vector>
+
+/**
+ * Product source that makes up products from a seeded random
+ * number generator.
+ *
+ * The same seed always gives the same products. Each property
+ * is picked from a weighted list of choices.
+ */
+class RandomProductSource : public ProductSource
+{
+public:
+  /// A weighted list of choices for one property
+  using Choices = std::vector<std::pair<Product::Properties, double>>;
+
+private:
+  /// Seed for the random number generator
+  unsigned mSeed;
+
+  /// Number of products to make, or 0 for no limit
+  long mCount;
+
+  /// Distance between products in pixels
+  double mSpacing;
+
+  /// Choices for the shape
+  Choices mShapes;
+  /// Choices for the color
+  Choices mColors;
+  /// Choices for the content
+  Choices mContents;
+
+  /// Products with any of these properties should be kicked
+  std::set<Product::Properties> mKick;
+
+  /// Random number generator
+  std::mt19937 mRandom;
+
+  /// Number of products made since the last rewind
+  long mMade = 0;
+
+  Product::Properties Pick(const Choices &choices);
+
+public:
+  /// Default constructor (disabled)
+  RandomProductSource() = delete;
+
+  RandomProductSource(unsigned seed, long count, double spacing, Choices shapes, Choices colors, Choices contents,
+                      std::set<Product::Properties> kick);
+
+  bool Next(ProductSpec &spec) override;
+
+  void Rewind() override;
+};
+
+#endif // RANDOMPRODUCTSOURCE_H
@@ -0,0 +1,42 @@
+/**
+ * @file XmlProductSource.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "../pch.h"
+#include "XmlProductSource.h"
+
+#include <algorithm>
+
+/**
+ * Add a product to the list.
+ *
+ * The conveyor needs the products in increasing placement, but a
+ * level file can list them in any order, so each one goes in after
+ * every product placed at or before it. Products with the same
+ * placement stay in file order.
+ * @param spec The product
+ */
+void XmlProductSource::Add(const ProductSpec &spec)
+{
+  auto loc = std::upper_bound(mProducts.begin(), mProducts.end(), spec.mPlacement,
+                              [](double placement, const ProductSpec &product)
+                              { return placement < product.mPlacement; });
+  mProducts.insert(loc, spec);
+}
+
+/**
+ * Get the next product
+ * @param spec Set to the next product if there is one
+ * @return False if the source has run out of products
+ */
+bool XmlProductSource::Next(ProductSpec &spec)
+{
+  if (mNext >= mProducts.size())
+  {
+    return false;
+  }
+
+  spec = mProducts[mNext++];
+  return true;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file XmlProductSource.h
+ * @author Nitish Maindoliya
+ */
+
+#ifndef XMLPRODUCTSOURCE_H
+#define XMLPRODUCTSOURCE_H
+
+#include "ProductSource.h"
+
+#include <vector>
+
+/**
+ * Product source for the product list in a level file.
+ */
+class XmlProductSource : public ProductSource
+{
+private:
+  /// The products, in increasing placement
+  std::vector<ProductSpec> mProducts;
+
+  /// Index of the next product
+  size_t mNext = 0;
+
+public:
+  void Add(const ProductSpec &spec);
+
+  bool Next(ProductSpec &spec) override;
+
+  /**
+   * Go back to the first product
+   */
+  void Rewind() override { mNext = 0; }
+};
+
+#endif // XMLPRODUCTSOURCE_H
@@ -0,0 +1,73 @@
+/**
+ * @file Span.h
+ * @author Nitish Maindoliya
+ */
+
+#ifndef SPAN_H
+#define SPAN_H
+
+#include <cassert>
+#include <cstddef>
+
+/**
+ * A view of a run of objects stored somewhere else
+ * @tparam T Type of the objects
+ */
+template <class T>
+class Span
+{
+private:
+  /// The first object
+  T *mData = nullptr;
+
+  /// Number of objects
+  size_t mSize = 0;
+
+public:
+  /// Constructor for an empty span
+  Span() = default;
+
+  /**
+   * Constructor
+   * @param data The first object
+   * @param size Number of objects
+   */
+  Span(T *data, size_t size) : mData(data), mSize(size) {}
+
+  /**
+   * Get the first object
+   * @return Pointer to the first object
+   */
+  T *begin() const { return mData; }
+
+  /**
+   * Get the end of the objects
+   * @return Pointer past the last object
+   */
+  T *end() const { return mData + mSize; }
+
+  /**
+   * Get the number of objects
+   * @return Number of objects
+   */
+  size_t size() const { return mSize; }
+
+  /**
+   * Are there no objects?
+   * @return True if empty
+   */
+  bool empty() const { return mSize == 0; }
+
+  /**
+   * Get an object
+   * @param i Index of the object
+   * @return The object
+   */
+  T &operator[](size_t i) const
+  {
+    assert(i < mSize);
+    return mData[i];
+  }
+};
+
+#endif // SPAN_H
@@ -0,0 +1,76 @@
+/**
+ * @file SpriteCache.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "SpriteCache.h"
+
+/**
+ * Get the bitmap for a variant of an image, making it if this is
+ * the first time the variant is drawn with this renderer
+ * @param graphics The graphics context that will draw the bitmap
+ * @param key The variant
+ * @return The bitmap
+ */
+const wxGraphicsBitmap &SpriteCache::Get(const std::shared_ptr<wxGraphicsContext> &graphics, const Key &key)
+{
+  if (graphics->GetRenderer() != mRenderer)
+  {
+    Clear();
+    mRenderer = graphics->GetRenderer();
+  }
+
+  const auto found = mIndex.find(key);
+  if (found != mIndex.end())
+  {
+    // Move to the front as the most recently used
+    mEntries.splice(mEntries.begin(), mEntries, found->second);
+    return found->second->mBitmap;
+  }
+
+  wxImage image = key.mMirror ? key.mImage->Mirror() : *key.mImage;
+  for (int turn = 0; turn < key.mQuarterTurns; turn++)
+  {
+    image = image.Rotate90();
+  }
+
+  if (image.GetWidth() != key.mWidth || image.GetHeight() != key.mHeight)
+  {
+    image = image.Scale(key.mWidth, key.mHeight, wxIMAGE_QUALITY_HIGH);
+  }
+
+  const size_t bytes = size_t(key.mWidth) * size_t(key.mHeight) * 4;
+  mEntries.push_front({key, graphics->CreateBitmapFromImage(image), bytes});
+  mIndex[key] = mEntries.begin();
+  mBytes += bytes;
+
+  Evict();
+  return mEntries.front().mBitmap;
+}
+
+/**
+ * Drop the least recently used variants until the rest fit in the
+ * budget. The most recently used one is always kept.
+ */
+void SpriteCache::Evict()
+{
+  while (mBytes > mBudget && mEntries.size() > 1)
+  {
+    const auto &last = mEntries.back();
+    mBytes -= last.mBytes;
+    mIndex.erase(last.mKey);
+    mEntries.pop_back();
+  }
+}
+
+/**
+ * Drop every bitmap in the cache
+ */
+void SpriteCache::Clear()
+{
+  mEntries.clear();
+  mIndex.clear();
+  mBytes = 0;
+  mRenderer = nullptr;
+}
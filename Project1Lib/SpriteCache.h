@@ -0,0 +1,151 @@
+/**
+ * @file SpriteCache.h
+ * @author Nitish Maindoliya
+ *
+ * Images converted once into bitmaps for the graphics renderer.
+ */
+
+#ifndef SPRITECACHE_H
+#define SPRITECACHE_H
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * Cache of the native bitmaps made from the game's images.
+ *
+ * Drawing a wxImage converts it to a native bitmap every time it
+ * is drawn, and drawing it at a size other than its own makes the
+ * renderer resample it. The cache makes each variant of an image
+ * that is drawn, mirrored, turned and scaled to the pixels it covers
+ * on the screen, the first time it is drawn, and keeps it.
+ *
+ * Variants are dropped least recently used first once they take
+ * more than the budget of memory, so the variants for an old window
+ * size go away after a resize. Bitmaps belong to the renderer that
+ * made them, so the cache is emptied whenever it is asked for a
+ * bitmap by a context with a different renderer.
+ *
+ * The images must live as long as the cache. The game's images do,
+ * since the game never unloads them.
+ */
+class SpriteCache
+{
+public:
+  /// Default memory budget in bytes
+  static constexpr size_t DefaultBudget = 64 * 1024 * 1024;
+
+  /**
+   * One variant of an image
+   */
+  struct Key
+  {
+    /// The image
+    const wxImage *mImage;
+
+    /// True if mirrored horizontally
+    bool mMirror;
+
+    /// Number of clockwise quarter turns, 0 to 3
+    int mQuarterTurns;
+
+    /// Width in screen pixels
+    int mWidth;
+
+    /// Height in screen pixels
+    int mHeight;
+
+    /**
+     * Equality operator
+     * @param other Key to compare to
+     * @return True if the keys are the same variant
+     */
+    bool operator==(const Key &other) const
+    {
+      return mImage == other.mImage && mMirror == other.mMirror && mQuarterTurns == other.mQuarterTurns &&
+             mWidth == other.mWidth && mHeight == other.mHeight;
+    }
+  };
+
+private:
+  /// Hash for a key
+  struct KeyHash
+  {
+    /**
+     * Hash a key
+     * @param key The key
+     * @return Hash value
+     */
+    size_t operator()(const Key &key) const
+    {
+      size_t hash = std::hash<const wxImage *>()(key.mImage);
+      for (size_t part : {size_t(key.mMirror), size_t(key.mQuarterTurns), size_t(key.mWidth), size_t(key.mHeight)})
+      {
+        hash = hash * 31 + part;
+      }
+      return hash;
+    }
+  };
+
+  /// A cached variant
+  struct Entry
+  {
+    /// The variant
+    Key mKey;
+
+    /// Its bitmap
+    wxGraphicsBitmap mBitmap;
+
+    /// Memory the bitmap takes in bytes
+    size_t mBytes;
+  };
+
+  /// The renderer the bitmaps were made with
+  wxGraphicsRenderer *mRenderer = nullptr;
+
+  /// The variants, most recently used first
+  std::list<Entry> mEntries;
+
+  /// Where each variant is in mEntries
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> mIndex;
+
+  /// Memory the variants may take in bytes
+  size_t mBudget;
+
+  /// Memory the variants take in bytes
+  size_t mBytes = 0;
+
+  void Evict();
+
+public:
+  /**
+   * Constructor
+   * @param budget Memory the variants may take in bytes
+   */
+  explicit SpriteCache(size_t budget = DefaultBudget) : mBudget(budget) {}
+
+  /// Copy constructor (disabled)
+  SpriteCache(const SpriteCache &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const SpriteCache &) = delete;
+
+  const wxGraphicsBitmap &Get(const std::shared_ptr<wxGraphicsContext> &graphics, const Key &key);
+
+  void Clear();
+
+  /**
+   * Get the number of variants in the cache
+   * @return Number of variants
+   */
+  size_t GetCount() const { return mEntries.size(); }
+
+  /**
+   * Get the memory the variants take
+   * @return Memory in bytes
+   */
+  size_t GetBytes() const { return mBytes; }
+};
+
+#endif // SPRITECACHE_H
@@ -0,0 +1,102 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "ThreadPool.h"
+
+/**
+ * Constructor
+ * @param threads Number of worker threads to start
+ */
+ThreadPool::ThreadPool(size_t threads)
+{
+  for (size_t i = 0; i < threads; i++)
+  {
+    mWorkers.emplace_back(&ThreadPool::Worker, this);
+  }
+}
+
+/**
+ * Destructor. Stops and joins the workers.
+ */
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopping = true;
+  }
+
+  mWorkReady.notify_all();
+  for (auto &worker : mWorkers)
+  {
+    worker.join();
+  }
+}
+
+/**
+ * Run a function for every index from 0 to count - 1.
+ *
+ * The calling thread works too and this returns once every
+ * index has finished.
+ * @param count Number of indices
+ * @param function Function to call with each index
+ */
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> &function)
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mFunction = &function;
+  mCount = count;
+  mNext = 0;
+  mFinished = 0;
+  mRun++;
+  mWorkReady.notify_all();
+
+  RunIndices(lock);
+
+  mWorkDone.wait(lock, [this] { return mFinished == mCount; });
+  mFunction = nullptr;
+}
+
+/**
+ * Take indices from the current run until there are none left
+ * @param lock Lock on mMutex, held on entry and exit
+ */
+void ThreadPool::RunIndices(std::unique_lock<std::mutex> &lock)
+{
+  while (mFunction != nullptr && mNext < mCount)
+  {
+    const auto index = mNext++;
+    const auto &function = *mFunction;
+
+    lock.unlock();
+    function(index);
+    lock.lock();
+
+    if (++mFinished == mCount)
+    {
+      mWorkDone.notify_all();
+    }
+  }
+}
+
+/**
+ * Loop run by each worker thread
+ */
+void ThreadPool::Worker()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  unsigned run = mRun;
+  while (true)
+  {
+    mWorkReady.wait(lock, [this, run] { return mStopping || mRun != run; });
+    if (mStopping)
+    {
+      return;
+    }
+
+    run = mRun;
+    RunIndices(lock);
+  }
+}
@@ -0,0 +1,81 @@
+/**
+ * @file ThreadPool.h
+ * @author Nitish Maindoliya
+ *
+ * A fixed set of worker threads for running loops in parallel.
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of worker threads.
+ *
+ * The only operation is ParallelFor, which runs a function for
+ * each index in a range across the workers and the calling thread
+ * and returns when they are all done.
+ */
+class ThreadPool
+{
+private:
+  /// The worker threads
+  std::vector<std::thread> mWorkers;
+
+  /// Protects everything below
+  std::mutex mMutex;
+
+  /// Signals the workers that there is work or that we are stopping
+  std::condition_variable mWorkReady;
+
+  /// Signals the caller that the work is finished
+  std::condition_variable mWorkDone;
+
+  /// The function being run
+  const std::function<void(size_t)> *mFunction = nullptr;
+
+  /// Number of indices in the current run
+  size_t mCount = 0;
+
+  /// Next index to hand out
+  size_t mNext = 0;
+
+  /// Number of indices finished
+  size_t mFinished = 0;
+
+  /// Incremented for every run so workers know there is new work
+  unsigned mRun = 0;
+
+  /// True when the pool is being destroyed
+  bool mStopping = false;
+
+  void Worker();
+
+  void RunIndices(std::unique_lock<std::mutex> &lock);
+
+public:
+  explicit ThreadPool(size_t threads);
+
+  /// Copy constructor (disabled)
+  ThreadPool(const ThreadPool &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool();
+
+  void ParallelFor(size_t count, const std::function<void(size_t)> &function);
+
+  /**
+   * Get the number of worker threads
+   * @return Number of threads, not counting the caller
+   */
+  size_t GetSize() const { return mWorkers.size(); }
+};
+
+#endif // THREADPOOL_H
@@ -0,0 +1,45 @@
+/**
+ * @file ControlPointVisitor.h
+ * @author Nitish Maindoliya
+ *
+ */
+
+#ifndef CONTROLPOINTVISITOR_H
+#define CONTROLPOINTVISITOR_H
+
+#include "StaticItemVisitor.h"
+
+/**
+ * Visitor that sets or resets the wire control points of the gates
+ */
+class ControlPointVisitor : public StaticItemVisitor<ControlPointVisitor>
+{
+private:
+  /// True to set the control points, false to reset them
+  bool mSet;
+
+public:
+  /**
+   * Constructor
+   * @param set True to set the control points, false to reset them
+   */
+  explicit ControlPointVisitor(bool set) : mSet(set) {}
+
+  /**
+   * Visit a gate
+   * @param gate Gate object we are visiting
+   */
+  void VisitGates(Gate *gate)
+  {
+    if (mSet)
+    {
+      gate->SetControlPoints();
+    }
+    else
+    {
+      gate->ResetControlPoints();
+    }
+  }
+};
+
+#endif // CONTROLPOINTVISITOR_H
@@ -0,0 +1,362 @@
+/**
+ * @file StaticItemVisitor.h
+ * @author Nitish Maindoliya
+ *
+ * Item visitor base class resolved at compile time.
+ */
+
+#ifndef STATICITEMVISITOR_H
+#define STATICITEMVISITOR_H
+
+#include "../Game.h"
+#include "../Items/Badge.h"
+#include "../Items/Conveyor.h"
+#include "../Items/LevelNotice.h"
+#include "../Items/Product.h"
+#include "../Items/Scoreboard.h"
+#include "../Items/Sensor.h"
+#include "../Gates/ANDGate.h"
+#include "../Gates/Beam.h"
+#include "../Gates/DFlipFlop.h"
+#include "../Gates/NOTGate.h"
+#include "../Gates/ORGate.h"
+#include "../Gates/SensorGate.h"
+#include "../Gates/Sparty.h"
+#include "../Gates/SRFlipFlop.h"
+
+#include <type_traits>
+
+/**
+ * Item visitor base class resolved at compile time.
+ *
+ * A visitor derives from this with itself as the template
+ * argument and declares only the Visit functions it needs, with
+ * the same names as in ItemVisitor. The calls are not virtual,
+ * so the compiler can inline them, and kinds of items the
+ * visitor has no Visit function for are skipped entirely.
+ *
+ * Visit the game with Game::Visit or a single item with VisitItem.
+ * @tparam Derived The visitor class
+ */
+template <class Derived>
+class StaticItemVisitor
+{
+protected:
+  /**
+   * Constructor
+   * Ensures this is an abstract class
+   */
+  StaticItemVisitor()
+  {
+  }
+
+  /**
+   * Does the visitor have its own version of a Visit function?
+   * @param visit Pointer to the Visit function as seen from the visitor
+   * @return False if it is the do nothing version in this class
+   */
+  template <class Class, class Visited>
+  static constexpr bool Handles(void (Class::*visit)(Visited *))
+  {
+    return !std::is_same_v<Class, StaticItemVisitor>;
+  }
+
+public:
+  /**
+   * Does the visitor do anything with gates?
+   * @return True if it has any gate Visit function
+   */
+  static constexpr bool HandlesGates()
+  {
+    return Handles(&Derived::VisitANDGate) || Handles(&Derived::VisitDFlipFlop) ||
+           Handles(&Derived::VisitNOTGate) || Handles(&Derived::VisitORGate) ||
+           Handles(&Derived::VisitSensorGate) || Handles(&Derived::VisitSparty) ||
+           Handles(&Derived::VisitSRFlipFlop) || Handles(&Derived::VisitGates);
+  }
+
+  /**
+   * Does the visitor do anything with beams?
+   * @return True if it visits beams or all gates
+   */
+  static constexpr bool HandlesBeams() { return Handles(&Derived::VisitBeam) || Handles(&Derived::VisitGates); }
+
+  /**
+   * Does the visitor do anything with products?
+   * @return True if it visits products
+   */
+  static constexpr bool HandlesProducts() { return Handles(&Derived::VisitProduct); }
+
+  /**
+   * Does the visitor do anything with the items that are not gates?
+   * @return True if it visits conveyors, products or other decor
+   */
+  static constexpr bool HandlesDecor()
+  {
+    return Handles(&Derived::VisitBadge) || Handles(&Derived::VisitConveyor) || HandlesProducts() ||
+           Handles(&Derived::VisitScoreBoard) || Handles(&Derived::VisitSensor);
+  }
+
+  /**
+   * Does the visitor do anything with level notices?
+   * @return True if it visits level notices
+   */
+  static constexpr bool HandlesLevelNotices() { return Handles(&Derived::VisitLevelNotice); }
+
+  /**
+   * Visit a Badge object
+   * @param badge Badge we are visiting
+   */
+  void VisitBadge(Badge *badge) {}
+
+  /**
+   * Visit a conveyor object
+   * @param conveyor Conveyor we are visiting
+   */
+  void VisitConveyor(Conveyor *conveyor) {}
+
+  /**
+   * Visit a LevelNotice object
+   * @param levelNotice LevelNotice object we are visiting
+   */
+  void VisitLevelNotice(LevelNotice *levelNotice) {}
+
+  /**
+   * Visit a Product object
+   * @param product Product object we are visiting
+   */
+  void VisitProduct(Product *product) {}
+
+  /**
+   * Visit a Scoreboard object
+   * @param scoreboard Scoreboard object we are visiting
+   */
+  void VisitScoreBoard(Scoreboard *scoreboard) {}
+
+  /**
+   * Visit a Sensor object
+   * @param sensor Sensor object we are visiting
+   */
+  void VisitSensor(Sensor *sensor) {}
+
+  /**
+   * Visit a ANDGate object
+   * @param ANDgate ANDGate object we are visiting
+   */
+  void VisitANDGate(ANDGate *ANDgate) {}
+
+  /**
+   * Visit a Beam object
+   * @param beam Beam object we are visiting
+   */
+  void VisitBeam(Beam *beam) {}
+
+  /**
+   * Visit a DFlipFlop object
+   * @param dFlipFlop DFlipFlop object we are visiting
+   */
+  void VisitDFlipFlop(DFlipFlop *dFlipFlop) {}
+
+  /**
+   * Visit a NOTGate object
+   * @param NOTgate NOTGate object we are visiting
+   */
+  void VisitNOTGate(NOTGate *NOTgate) {}
+
+  /**
+   * Visit a ORGate object
+   * @param ORgate ORGate object we are visiting
+   */
+  void VisitORGate(ORGate *ORgate) {}
+
+  /**
+   * Visit a SensorGate object
+   * @param Sensorgate SensorGate object we are visiting
+   */
+  void VisitSensorGate(SensorGate *Sensorgate) {}
+
+  /**
+   * Visit a Sparty object
+   * @param sparty Sparty object we are visiting
+   */
+  void VisitSparty(Sparty *sparty) {}
+
+  /**
+   * Visit a SRFlipFlop object
+   * @param srFlipFlop SRFlipFlop object we are visiting
+   */
+  void VisitSRFlipFlop(SRFlipFlop *srFlipFlop) {}
+
+  /**
+   * Visit all gates
+   * @param gate Gate object we are visiting
+   */
+  void VisitGates(Gate *gate) {}
+};
+
+/**
+ * Visit one item, the same way Item::Accept does.
+ *
+ * The kind of item comes from its type, so there is no virtual call.
+ * @tparam Visitor The visitor class, derived from StaticItemVisitor
+ * @param item The item to visit
+ * @param visitor The visitor
+ */
+template <class Visitor>
+void VisitItem(Item *item, Visitor &visitor)
+{
+  switch (item->GetType())
+  {
+  case ItemType::Badge:
+    visitor.VisitBadge(static_cast<Badge *>(item));
+    break;
+
+  case ItemType::Conveyor:
+    {
+      auto conveyor = static_cast<Conveyor *>(item);
+      visitor.VisitConveyor(conveyor);
+      if constexpr (Visitor::HandlesProducts())
+      {
+        for (const auto &product : conveyor->GetProducts())
+        {
+          visitor.VisitProduct(product.get());
+        }
+      }
+      break;
+    }
+
+  case ItemType::LevelNotice:
+    visitor.VisitLevelNotice(static_cast<LevelNotice *>(item));
+    break;
+
+  case ItemType::Product:
+    visitor.VisitProduct(static_cast<Product *>(item));
+    break;
+
+  case ItemType::Scoreboard:
+    visitor.VisitScoreBoard(static_cast<Scoreboard *>(item));
+    break;
+
+  case ItemType::Sensor:
+    visitor.VisitSensor(static_cast<Sensor *>(item));
+    break;
+
+  case ItemType::ANDGate:
+    visitor.VisitANDGate(static_cast<ANDGate *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::Beam:
+    visitor.VisitBeam(static_cast<Beam *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::DFlipFlop:
+    visitor.VisitDFlipFlop(static_cast<DFlipFlop *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::NOTGate:
+    visitor.VisitNOTGate(static_cast<NOTGate *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::ORGate:
+    visitor.VisitORGate(static_cast<ORGate *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::SensorGate:
+    visitor.VisitSensorGate(static_cast<SensorGate *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::Sparty:
+    visitor.VisitSparty(static_cast<Sparty *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+
+  case ItemType::SRFlipFlop:
+    visitor.VisitSRFlipFlop(static_cast<SRFlipFlop *>(item));
+    visitor.VisitGates(static_cast<Gate *>(item));
+    break;
+  }
+}
+
+/**
+ * Visit the items in the game with a compile time visitor.
+ *
+ * Visits the same items as Accept. Whole groups of items the
+ * visitor does nothing with are never looked at.
+ * @tparam Visitor The visitor class, derived from StaticItemVisitor
+ * @param visitor The visitor
+ */
+template <class Visitor>
+void Game::Visit(Visitor &visitor) const
+{
+  if constexpr (Visitor::HandlesDecor())
+  {
+    for (const auto &item : mDecor)
+    {
+      VisitItem(item.get(), visitor);
+    }
+  }
+
+  if constexpr (Visitor::HandlesGates())
+  {
+    for (const auto &gate : mGates)
+    {
+      VisitItem(gate.get(), visitor);
+    }
+  }
+
+  if constexpr (Visitor::HandlesBeams())
+  {
+    for (const auto &beam : mBeams)
+    {
+      VisitItem(beam.get(), visitor);
+    }
+  }
+
+  if constexpr (Visitor::HandlesLevelNotices())
+  {
+    for (const auto &notice : mNotices)
+    {
+      VisitItem(notice.get(), visitor);
+    }
+  }
+}
+
+/**
+ * Call a function for every item in the game, in drawing order.
+ *
+ * The items are not copied, so the function must not add or
+ * remove items except through Game::Add and Game::Remove
+ * while the game is updating.
+ * @tparam Function Callable taking an Item pointer
+ * @param function The function to call
+ */
+template <class Function>
+void Game::ForEachItem(Function function) const
+{
+  for (const auto &item : mDecor)
+  {
+    function(item.get());
+  }
+
+  for (const auto &gate : mGates)
+  {
+    function(gate.get());
+  }
+
+  for (const auto &beam : mBeams)
+  {
+    function(beam.get());
+  }
+
+  for (const auto &notice : mNotices)
+  {
+    function(notice.get());
+  }
+}
+
+#endif // STATICITEMVISITOR_H
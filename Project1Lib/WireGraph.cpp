@@ -0,0 +1,162 @@
+/**
+ * @file WireGraph.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "WireGraph.h"
+
+/**
+ * Constructor
+ * @param outputPins Handles of the output pins
+ * @param inputPins Handles of the input pins
+ */
+WireGraph::WireGraph(const SlotTable<OutputPin> &outputPins, const SlotTable<InputPin> &inputPins) :
+    mOutputPins(outputPins), mInputPins(inputPins)
+{
+}
+
+/**
+ * Connect an output pin to an input pin.
+ *
+ * Any wire already into the input pin is replaced.
+ * @param output Handle of the output pin
+ * @param input Handle of the input pin
+ */
+void WireGraph::Connect(Handle output, Handle input)
+{
+  if (input.GetIndex() >= mDrivers.size())
+  {
+    mDrivers.resize(input.GetIndex() + 1);
+  }
+
+  mDrivers[input.GetIndex()] = {input, output};
+  mDirty = true;
+}
+
+/**
+ * Remove the wire into an input pin, if there is one
+ * @param input Handle of the input pin
+ */
+void WireGraph::Disconnect(Handle input)
+{
+  if (input.GetIndex() < mDrivers.size() && mDrivers[input.GetIndex()].mInput == input)
+  {
+    mDrivers[input.GetIndex()] = {};
+    mDirty = true;
+  }
+}
+
+/**
+ * Note that an output pin is going away.
+ *
+ * Its wires stay as drivers so the input pins find the handle
+ * stale and disconnect themselves, but its row has to be rebuilt
+ * before a new pin can reuse the slot.
+ * @param output Handle of the output pin
+ */
+void WireGraph::RemoveOutput(Handle output) { mDirty = true; }
+
+/**
+ * Get the output pin driving an input pin
+ * @param input Handle of the input pin
+ * @return Handle of the output pin, null if not connected. It
+ * may be stale if the output pin has been deleted.
+ */
+Handle WireGraph::GetDriver(Handle input) const
+{
+  if (input.GetIndex() < mDrivers.size() && mDrivers[input.GetIndex()].mInput == input)
+  {
+    return mDrivers[input.GetIndex()].mOutput;
+  }
+
+  return Handle();
+}
+
+/**
+ * Get the input pins an output pin drives
+ * @param output Handle of the output pin
+ * @return Handles of the input pins, in slot order
+ */
+Span<const Handle> WireGraph::GetFanout(Handle output)
+{
+  if (mDirty)
+  {
+    Rebuild();
+  }
+
+  const auto row = output.GetIndex();
+  if (row + 1 >= mOffsets.size() || mOutputPins.Get(output) == nullptr)
+  {
+    return {};
+  }
+
+  return Span<const Handle>(mTargets.data() + mOffsets[row], mOffsets[row + 1] - mOffsets[row]);
+}
+
+/**
+ * Get the number of wires between pins that both still exist
+ * @return Number of wires
+ */
+size_t WireGraph::GetWireCount()
+{
+  if (mDirty)
+  {
+    Rebuild();
+  }
+
+  return mTargets.size();
+}
+
+/**
+ * Does a wire still have a pin at both ends?
+ * @param driver The wire
+ * @return True if both pins exist
+ */
+bool WireGraph::IsLive(const Driver &driver) const
+{
+  return mInputPins.Get(driver.mInput) != nullptr && mOutputPins.Get(driver.mOutput) != nullptr;
+}
+
+/**
+ * Rebuild the fanout rows from the drivers with a counting sort
+ */
+void WireGraph::Rebuild()
+{
+  uint32_t rows = 0;
+  for (const auto &driver : mDrivers)
+  {
+    if (IsLive(driver))
+    {
+      rows = std::max(rows, driver.mOutput.GetIndex() + 1);
+    }
+  }
+
+  // Count the wires out of each output pin slot, then turn
+  // the counts into the start of each row
+  mOffsets.assign(rows + 1, 0);
+  for (const auto &driver : mDrivers)
+  {
+    if (IsLive(driver))
+    {
+      mOffsets[driver.mOutput.GetIndex() + 1]++;
+    }
+  }
+
+  for (uint32_t row = 0; row < rows; row++)
+  {
+    mOffsets[row + 1] += mOffsets[row];
+  }
+
+  mTargets.resize(mOffsets.back());
+  mFill.assign(mOffsets.begin(), mOffsets.end() - 1);
+  for (const auto &driver : mDrivers)
+  {
+    if (IsLive(driver))
+    {
+      mTargets[mFill[driver.mOutput.GetIndex()]++] = driver.mInput;
+    }
+  }
+
+  mDirty = false;
+}
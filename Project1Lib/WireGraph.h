@@ -0,0 +1,92 @@
+/**
+ * @file WireGraph.h
+ * @author Nitish Maindoliya
+ *
+ * The wires between the pins of the gates.
+ */
+
+#ifndef WIREGRAPH_H
+#define WIREGRAPH_H
+
+#include <vector>
+
+#include "SlotTable.h"
+#include "Span.h"
+
+class InputPin;
+class OutputPin;
+
+/**
+ * Store for the wires in the game.
+ *
+ * An input pin is driven by at most one output pin, so wires are
+ * edited as a driver for each input pin, indexed by the input pin's
+ * slot. The fanout of every output pin is kept in compressed sparse
+ * row form: the targets of output pin slot i are
+ * mTargets[mOffsets[i]] to mTargets[mOffsets[i + 1]]. The rows are
+ * rebuilt in one pass the first time they are read after an edit.
+ */
+class WireGraph
+{
+private:
+  /// The wire into an input pin
+  struct Driver
+  {
+    /// The input pin
+    Handle mInput;
+
+    /// The output pin driving it, null if none
+    Handle mOutput;
+  };
+
+  /// Handles of the output pins, to skip wires from deleted pins
+  const SlotTable<OutputPin> &mOutputPins;
+
+  /// Handles of the input pins, to skip wires to deleted pins
+  const SlotTable<InputPin> &mInputPins;
+
+  /// The wire into each input pin, by input pin slot
+  std::vector<Driver> mDrivers;
+
+  /// Start of the fanout of each output pin slot in mTargets
+  std::vector<uint32_t> mOffsets;
+
+  /// The input pins driven by each output pin, by output pin slot
+  std::vector<Handle> mTargets;
+
+  /// Next free target for each row while rebuilding
+  std::vector<uint32_t> mFill;
+
+  /// True if the rows are out of date
+  bool mDirty = false;
+
+  bool IsLive(const Driver &driver) const;
+
+  void Rebuild();
+
+public:
+  WireGraph(const SlotTable<OutputPin> &outputPins, const SlotTable<InputPin> &inputPins);
+
+  /// Default constructor (disabled)
+  WireGraph() = delete;
+
+  /// Copy constructor (disabled)
+  WireGraph(const WireGraph &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const WireGraph &) = delete;
+
+  void Connect(Handle output, Handle input);
+
+  void Disconnect(Handle input);
+
+  void RemoveOutput(Handle output);
+
+  Handle GetDriver(Handle input) const;
+
+  Span<const Handle> GetFanout(Handle output);
+
+  size_t GetWireCount();
+};
+
+#endif // WIREGRAPH_H
@@ -0,0 +1,215 @@
+/**
+ * @file WirePath.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include "pch.h"
+#include "WirePath.h"
+#include "GraphicsResources.h"
+
+#include <algorithm>
+#include <cmath>
+
+/// Length of Plus lines
+static const int PlusSize = 20;
+
+/// Offset for Point labels
+static const wxSize PointLabelOffset = wxSize(PlusSize / 4, PlusSize * -1.5);
+
+/// Number of straight pieces the curve is flattened into
+static const int FlattenSegments = 24;
+
+/// How close to a wire in pixels a click has to be to hit it
+static const double WireHitDistance = 5;
+
+/// Color to use for drawing a zero connection wire
+const wxColour ConnectionColorZero = *wxBLACK;
+
+/// Color to use for drawing a one connection wire
+const wxColour ConnectionColorOne = *wxRED;
+
+/// Color to use for drawing an unknown state connection wire
+const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
+
+/**
+ * Get how far the control points are from the ends of a wire
+ * @param start Where the wire starts
+ * @param end Where the wire ends
+ * @return Horizontal offset of the control points
+ */
+double WirePath::GetOffset(wxPoint start, wxPoint end)
+{
+  return std::min(BezierMaxOffset, std::hypot(double(start.x - end.x), double(start.y - end.y)));
+}
+
+/**
+ * Set the ends of the wire, working out the curve again if
+ * either of them moved
+ * @param start Where the wire starts, at the output pin
+ * @param end Where the wire ends
+ */
+void WirePath::SetEnds(wxPoint start, wxPoint end)
+{
+  if (mHasEnds && start == mStart && end == mEnd)
+  {
+    return;
+  }
+
+  mStart = start;
+  mEnd = end;
+  mHasEnds = true;
+  mPathValid = false;
+
+  const double offset = GetOffset(start, end);
+  const wxPoint2DDouble p1(start.x, start.y);
+  const wxPoint2DDouble p4(end.x, end.y);
+  mP2 = wxPoint2DDouble(start.x + offset, start.y);
+  mP3 = wxPoint2DDouble(end.x - offset, end.y);
+
+  mPolyline.resize(FlattenSegments + 1);
+  for (int i = 0; i <= FlattenSegments; i++)
+  {
+    const double t = double(i) / FlattenSegments;
+    const double u = 1 - t;
+    const double b1 = u * u * u;
+    const double b2 = 3 * u * u * t;
+    const double b3 = 3 * u * t * t;
+    const double b4 = t * t * t;
+    mPolyline[i] = wxPoint2DDouble(b1 * p1.m_x + b2 * mP2.m_x + b3 * mP3.m_x + b4 * p4.m_x,
+                                   b1 * p1.m_y + b2 * mP2.m_y + b3 * mP3.m_y + b4 * p4.m_y);
+  }
+}
+
+/**
+ * Draw the wire with the current pen
+ * @param gc The graphics context to draw on
+ */
+void WirePath::Draw(const std::shared_ptr<wxGraphicsContext> &gc)
+{
+  // Paths belong to the renderer that made them
+  if (!mPathValid || gc->GetRenderer() != mRenderer)
+  {
+    mPath = gc->CreatePath();
+    mPath.MoveToPoint(mStart.x, mStart.y);
+    mPath.AddCurveToPoint(mP2, mP3, wxPoint2DDouble(mEnd.x, mEnd.y));
+
+    mRenderer = gc->GetRenderer();
+    mPathValid = true;
+  }
+
+  gc->StrokePath(mPath);
+}
+
+/**
+ * Draw the control points of the curve and the lines between them
+ * @param gc The graphics context to draw on
+ * @param resources Pens and fonts for the graphics context
+ */
+void WirePath::DrawControlPoints(const std::shared_ptr<wxGraphicsContext> &gc, GraphicsResources &resources) const
+{
+  const wxPoint2DDouble p1(mStart.x, mStart.y);
+  const wxPoint2DDouble p2 = mP2;
+  const wxPoint2DDouble p3 = mP3;
+
+  // Draw the red pluses
+  gc->SetPen(resources.GetPen(gc, *wxRED));
+
+  gc->StrokeLine(p1.m_x - PlusSize/2, p1.m_y, p1.m_x + PlusSize/2, p2.m_y);
+  gc->StrokeLine(p1.m_x, p1.m_y - PlusSize/2, p1.m_x, p2.m_y + PlusSize/2);
+
+  gc->StrokeLine(p2.m_x - PlusSize/2, p2.m_y, p2.m_x + PlusSize/2, p2.m_y);
+  gc->StrokeLine(p2.m_x, p2.m_y - PlusSize/2, p2.m_x, p2.m_y + PlusSize/2);
+
+  gc->StrokeLine(p3.m_x - PlusSize/2, p3.m_y, p3.m_x + PlusSize/2, p3.m_y);
+  gc->StrokeLine(p3.m_x, p3.m_y - PlusSize/2, p3.m_x, p3.m_y + PlusSize/2);
+
+  gc->StrokeLine(mEnd.x - PlusSize/2, mEnd.y, mEnd.x + PlusSize/2, mEnd.y);
+  gc->StrokeLine(mEnd.x, mEnd.y - PlusSize/2, mEnd.x, mEnd.y + PlusSize/2);
+
+  // Draw the green parallelogram
+  wxGraphicsPath path = gc->CreatePath();
+  gc->SetPen(resources.GetPen(gc, *wxGREEN));
+
+  path.MoveToPoint(p1.m_x, p1.m_y);
+  path.AddLineToPoint(p2.m_x, p2.m_y);
+  path.AddLineToPoint(mEnd.x, mEnd.y);
+  path.AddLineToPoint(p3.m_x, p3.m_y);
+  path.AddLineToPoint(p1.m_x, p1.m_y);
+  gc->StrokePath(path);
+
+  // Draw black labels for points p1, p2, p3, p3
+  gc->SetPen(resources.GetPen(gc, *wxBLACK));
+  gc->DrawText(L"p1",p1.m_x + PointLabelOffset.x, p1.m_y + PointLabelOffset.y);
+  gc->DrawText(L"p2",p2.m_x + PointLabelOffset.x, p2.m_y + PointLabelOffset.y);
+  gc->DrawText(L"p3",p3.m_x + PointLabelOffset.x, p3.m_y + PointLabelOffset.y);
+  gc->DrawText(L"p4",mEnd.x + PointLabelOffset.x, mEnd.y + PointLabelOffset.y);
+}
+
+/**
+ * Is a location on the wire?
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return True if the location is within WireHitDistance of the curve
+ */
+bool WirePath::HitTest(double x, double y) const
+{
+  for (size_t i = 1; i < mPolyline.size(); i++)
+  {
+    // Find the nearest point on this piece
+    const auto &a = mPolyline[i - 1];
+    const double dx = mPolyline[i].m_x - a.m_x;
+    const double dy = mPolyline[i].m_y - a.m_y;
+    const double length2 = dx * dx + dy * dy;
+    const double t = length2 > 0 ? std::clamp(((x - a.m_x) * dx + (y - a.m_y) * dy) / length2, 0.0, 1.0) : 0;
+
+    if (std::hypot(a.m_x + dx * t - x, a.m_y + dy * t - y) <= WireHitDistance)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * Get the area a wire is drawn in.
+ *
+ * The curve stays inside the box around its control points.
+ * @param start Where the wire starts
+ * @param end Where the wire ends
+ * @param controlPoints True if the control points are drawn
+ * @return Bounding rectangle in virtual pixels
+ */
+wxRect WirePath::GetBounds(wxPoint start, wxPoint end, bool controlPoints)
+{
+  const int offset = int(std::ceil(GetOffset(start, end)));
+
+  const int left = std::min(start.x, end.x - offset);
+  const int right = std::max(start.x + offset, end.x);
+  const int top = std::min(start.y, end.y);
+  const int bottom = std::max(start.y, end.y);
+
+  wxRect bounds(left, top, right - left + 1, bottom - top + 1);
+
+  // The control points and their labels go around the points
+  bounds.Inflate(controlPoints ? PlusSize * 2 : LineWidth);
+  return bounds;
+}
+
+/**
+ * Get the color of a wire or pin in a state
+ * @param state The state
+ * @return The color
+ */
+const wxColour &WirePath::GetColour(States state)
+{
+  switch (state)
+  {
+  case States::Zero:
+    return ConnectionColorZero;
+  case States::One:
+    return ConnectionColorOne;
+  default:
+    return ConnectionColorUnknown;
+  }
+}
@@ -0,0 +1,86 @@
+/**
+ * @file WirePath.h
+ * @author Nitish Maindoliya
+ *
+ * The curve of a wire between two pins.
+ */
+
+#ifndef WIREPATH_H
+#define WIREPATH_H
+
+#include <memory>
+#include <vector>
+
+#include "States.h"
+
+class GraphicsResources;
+
+/// Maximum offset of Bezier control points relative to line ends
+static constexpr double BezierMaxOffset = 200;
+
+/// Line width for drawing lines between pins
+static constexpr int LineWidth = 3;
+
+/**
+ * The Bezier curve of a wire, kept from frame to frame.
+ *
+ * The control points, the graphics path and a flattened polyline
+ * used for hit testing are only worked out again when one of the
+ * ends moves, which is when the gate at that end is dragged.
+ */
+class WirePath
+{
+private:
+  /// Where the wire starts, at the output pin
+  wxPoint mStart;
+
+  /// Where the wire ends
+  wxPoint mEnd;
+
+  /// Control point near the start
+  wxPoint2DDouble mP2;
+
+  /// Control point near the end
+  wxPoint2DDouble mP3;
+
+  /// The curve as a line through points along it
+  std::vector<wxPoint2DDouble> mPolyline;
+
+  /// The curve for drawing
+  wxGraphicsPath mPath;
+
+  /// Renderer the path was created with
+  wxGraphicsRenderer *mRenderer = nullptr;
+
+  /// True once the ends have been set
+  bool mHasEnds = false;
+
+  /// True if mPath matches the ends
+  bool mPathValid = false;
+
+  static double GetOffset(wxPoint start, wxPoint end);
+
+public:
+  /// Constructor
+  WirePath() = default;
+
+  /// Copy constructor (disabled)
+  WirePath(const WirePath &) = delete;
+
+  /// Assignment operator (disabled)
+  void operator=(const WirePath &) = delete;
+
+  void SetEnds(wxPoint start, wxPoint end);
+
+  void Draw(const std::shared_ptr<wxGraphicsContext> &gc);
+
+  void DrawControlPoints(const std::shared_ptr<wxGraphicsContext> &gc, GraphicsResources &resources) const;
+
+  bool HitTest(double x, double y) const;
+
+  static wxRect GetBounds(wxPoint start, wxPoint end, bool controlPoints);
+
+  static const wxColour &GetColour(States state);
+};
+
+#endif // WIREPATH_H
@@ -19,9 +19,18 @@
 #include "Items/Product.h"
 #include "Items/Conveyor.h"
 #include "Score.h"
+#include "Sources/XmlProductSource.h"
+#include "Sources/RandomProductSource.h"
+#include "Sources/FileProductSource.h"
 #include <regex>
 #include <sstream>
 
+/// X offset from the sensor to its first sensor gate
+const double SensorGateOffsetX = 200;
+
+/// Y offset from the sensor to its first sensor gate
+const double SensorGateOffsetY = 105;
+
 XmlLoader::XmlLoader(Game *game) :
   mGame(game)
 {
@@ -39,32 +48,20 @@ void XmlLoader::LoadItemAttributes(Item *item, wxXmlNode *node)
 void XmlLoader::LoadSensor(Sensor *sensor, wxXmlNode *node)
 {
   LoadItemAttributes(sensor, node);
-  double sensorX = 355; // First sensor gate x position
-  double sensorY = 535; // First sensor gate y position
+  // The sensor gates are stacked to the lower right of the sensor
+  double sensorX = sensor->GetX() + SensorGateOffsetX; // First sensor gate x position
+  double sensorY = sensor->GetY() + SensorGateOffsetY; // First sensor gate y position
 
   int sensorNumber = 0;
   for (wxXmlNode *sensorGate = node->GetChildren(); sensorGate != nullptr; sensorGate = sensorGate->GetNext())
   {
     std::shared_ptr<SensorGate> sensorGateItem = nullptr;
 
-    const std::map<std::wstring, Product::Properties> gateTypes = {{L"izzo", Product::Properties::Izzo},
-                                                                   {L"smith", Product::Properties::Smith},
-                                                                   {L"red", Product::Properties::Red},
-                                                                   {L"green", Product::Properties::Green},
-                                                                   {L"blue", Product::Properties::Blue},
-                                                                   {L"white", Product::Properties::White},
-                                                                   {L"square", Product::Properties::Square},
-                                                                   {L"diamond", Product::Properties::Diamond},
-                                                                   {L"circle", Product::Properties::Circle},
-                                                                   {L"football", Product::Properties::Football},
-                                                                   {L"basketball", Product::Properties::Basketball},
-                                                                   {L"none", Product::Properties::None}};
-
-    std::wstring gateName = sensorGate->GetName().ToStdWstring();
-    auto it = gateTypes.find(gateName);
-    if (it != gateTypes.end())
+    if (auto property = Product::FindProperty(sensorGate->GetName().ToStdWstring()); property)
     {
-      sensorGateItem = std::make_shared<SensorGate>(mGame, it->second);
+      sensorGateItem = mGame->GetArena().Make<SensorGate>(mGame, *property);
+      sensorGateItem->SetLine(sensor->GetLine());
+      sensorGateItem->SetSensor(sensor);
       sensorGateItem->SetX(sensorX);
       sensorGateItem->SetY(sensorY + sensorNumber * sensorGateItem->GetHeight());
       sensorNumber++;
@@ -130,8 +127,6 @@ void XmlLoader::LoadSparty(Sparty *sparty, wxXmlNode *node)
 
 void XmlLoader::LoadConveyor(Conveyor *conveyor, wxXmlNode *node)
 {
-  std::shared_ptr<Product> prod;
-
   LoadItemAttributes(conveyor, node);
 
   int height = 0;
@@ -150,6 +145,24 @@ void XmlLoader::LoadConveyor(Conveyor *conveyor, wxXmlNode *node)
   conveyor->SetSpeed(speed);
   conveyor->SetPanel(panelX, panelY);
 
+  // A level can make up products or read them from a file
+  // instead of listing them
+  for (auto child = node->GetChildren(); child != nullptr; child = child->GetNext())
+  {
+    if (child->GetName() == L"random")
+    {
+      conveyor->SetSource(LoadRandomSource(child));
+      return;
+    }
+
+    if (child->GetName() == L"stream")
+    {
+      conveyor->SetSource(std::make_unique<FileProductSource>(child->GetAttribute(L"file").ToStdWstring()));
+      return;
+    }
+  }
+
+  auto source = std::make_unique<XmlProductSource>();
   double lastPlacement = 0;
 
   for (auto product = node->GetChildren(); product != nullptr; product = product->GetNext())
@@ -157,42 +170,65 @@ void XmlLoader::LoadConveyor(Conveyor *conveyor, wxXmlNode *node)
     if (product->GetName() != "product")
       continue;
 
-    std::wstring placementStr = product->GetAttribute(L"placement", L"0").ToStdWstring();
-    double placement;
+    ProductSpec spec;
+    spec.mPlacement =
+      ProductSource::ParsePlacement(product->GetAttribute(L"placement", L"0").ToStdWstring(), lastPlacement);
+    lastPlacement = spec.mPlacement;
 
-    if (placementStr[0] == L'+')
-    {
-      placementStr = placementStr.substr(1);
-      double relativeValue;
-      std::wstringstream(placementStr) >> relativeValue;
-      placement = lastPlacement + relativeValue;
-    }
-    else
+    spec.mShape = Product::FindProperty(product->GetAttribute(L"shape").ToStdWstring()).value_or(spec.mShape);
+    spec.mColor = Product::FindProperty(product->GetAttribute(L"color").ToStdWstring()).value_or(spec.mColor);
+    if (product->HasAttribute(L"content"))
     {
-      std::wstringstream(placementStr) >> placement;
+      spec.mContent = Product::FindProperty(product->GetAttribute(L"content").ToStdWstring()).value_or(spec.mContent);
     }
 
-    lastPlacement = placement;
+    spec.mKick = product->GetAttribute(L"kick", L"no") == L"yes";
+    source->Add(spec);
+  }
+
+  conveyor->SetSource(std::move(source));
+}
 
-    auto shape = Product::NamesToProperties.at(product->GetAttribute(L"shape").ToStdWstring());
-    auto color = Product::NamesToProperties.at(product->GetAttribute(L"color").ToStdWstring());
-    Product::Properties content = Product::Properties::None;
-    if (product->HasAttribute(L"content"))
+std::unique_ptr<ProductSource> XmlLoader::LoadRandomSource(wxXmlNode *node)
+{
+  long seed = 0, count = 0;
+  double spacing = 150;
+  node->GetAttribute(L"seed", L"0").ToLong(&seed);
+  node->GetAttribute(L"count", L"0").ToLong(&count);
+  node->GetAttribute(L"spacing", L"150").ToDouble(&spacing);
+
+  // Choices are a list like "red:2,green:1". A choice with no weight has weight 1.
+  auto loadChoices = [node](const wxString &name, const wxString &defaultValue)
+  {
+    RandomProductSource::Choices choices;
+    std::wstringstream stream(node->GetAttribute(name, defaultValue).ToStdWstring());
+    std::wstring choice;
+    while (std::getline(stream, choice, L','))
     {
-      content = Product::NamesToProperties.at(product->GetAttribute(L"content").ToStdWstring());
+      double weight = 1;
+      auto colon = choice.find(L':');
+      if (colon != std::wstring::npos)
+      {
+        std::wstringstream(choice.substr(colon + 1)) >> weight;
+        choice = choice.substr(0, colon);
+      }
+
+      if (auto property = Product::FindProperty(choice); property)
+      {
+        choices.emplace_back(*property, weight);
+      }
     }
 
-    bool kick = product->GetAttribute(L"kick", L"no") == L"yes";
-    prod = std::make_shared<Product>(mGame, placement, shape, color, content, kick);
-
-    prod->SetX(conveyor->GetX());
-    prod->SetY(conveyor->GetY() - placement);
+    return choices;
+  };
 
-    mGame->Add(prod);
-  }
-  // Last product
-  if (prod != nullptr)
+  std::set<Product::Properties> kick;
+  for (const auto &choice : loadChoices(L"kick", L""))
   {
-    prod->SetLast();
+    kick.insert(choice.first);
   }
+
+  return std::make_unique<RandomProductSource>(unsigned(seed), count, spacing, loadChoices(L"shape", L"square"),
+                                               loadChoices(L"color", L"red"), loadChoices(L"content", L"none"),
+                                               kick);
 }
@@ -16,6 +16,7 @@
 #define PROJECT1_XMLLOADER_H
 
 #include <wx/xml/xml.h>
+#include <memory>
 
 
 // Forward declarations
@@ -27,6 +28,7 @@ class Scoreboard;
 class Conveyor;
 class Score;
 class Product;
+class ProductSource;
 
 /**
  * Class to handle XML loading operations for game items
@@ -77,6 +79,13 @@ public:
    * @param node XML node to load from
    */
   void LoadConveyor(Conveyor* conveyor, wxXmlNode* node);
+
+  /**
+   * Load a random product source from XML node
+   * @param node XML node containing the source settings
+   * @return The product source
+   */
+  std::unique_ptr<ProductSource> LoadRandomSource(wxXmlNode* node);
 };
 
 #endif //PROJECT1_XMLLOADER_H
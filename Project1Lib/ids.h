@@ -44,7 +44,11 @@ enum IDs
   /// Level>Level 8 menu option
   IDM_LEVEL_8,
 
-  /// Gates>AND menu option
+  /// Level>Level 9 menu option
+  IDM_LEVEL_9,
+
+  /// Gates>AND menu option. The Gates menu options are in the
+  /// same order as MenuGateTypes.
   IDM_GATES_AND,
 
   /// Gates>OR menu option
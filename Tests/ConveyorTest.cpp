@@ -0,0 +1,232 @@
+/**
+ * @file ConveyorTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <ProductionLine.h>
+#include <Items/Conveyor.h>
+#include <Items/Product.h>
+#include <Gates/Beam.h>
+#include <Gates/Sparty.h>
+#include <Sources/XmlProductSource.h>
+
+/// Longest a test lets a conveyor run in seconds
+static const double MaximumRunTime = 120;
+
+/// Time step for running a conveyor in seconds
+static const double RunStep = 0.03;
+
+/// Time from Sparty's input going high until the boot reaches the
+/// belt in level 0, the kick duration times the kick point
+static const double KickDelay = 0.25 * 0.35;
+
+class ConveyorTest : public ::testing::Test
+{
+protected:
+  /// The game
+  Game mGame;
+
+  /// The first line of level 0
+  ProductionLine *mLine = nullptr;
+
+  /// The conveyor on that line
+  Conveyor *mConveyor = nullptr;
+
+  void SetUp() override
+  {
+    mGame.LoadLevel(0);
+    mLine = mGame.GetLines().front().get();
+    mConveyor = mLine->GetConveyor();
+    ASSERT_NE(nullptr, mConveyor);
+    ASSERT_NE(nullptr, mLine->GetBeam());
+  }
+
+  /**
+   * Give the conveyor one product that starts in the beam
+   * @param kick True if the product should be kicked
+   */
+  void SetBeamProduct(bool kick)
+  {
+    ProductSpec spec;
+    spec.mPlacement = mConveyor->GetY() - mLine->GetBeam()->GetY();
+    spec.mKick = kick;
+
+    auto source = std::make_unique<XmlProductSource>();
+    source->Add(spec);
+    mConveyor->SetSource(std::move(source));
+  }
+
+  /**
+   * Make the line's Sparty kick by setting its input high
+   */
+  void KickWithSparty()
+  {
+    auto sparty = mLine->GetSparty();
+    ASSERT_NE(nullptr, sparty);
+    sparty->GetInputPins()[0].SetState(States::One);
+    sparty->ComputeState();
+  }
+
+  /**
+   * Run the conveyor until it finishes or runs out of time
+   * @return True if the conveyor finished
+   */
+  bool RunUntilFinished()
+  {
+    for (double time = 0; time < MaximumRunTime; time += RunStep)
+    {
+      if (mConveyor->IsFinished())
+      {
+        return true;
+      }
+
+      mConveyor->Advance(RunStep);
+    }
+
+    return mConveyor->IsFinished();
+  }
+
+  /**
+   * Run the conveyor until every product has gone off the screen
+   * @return True if no products are left
+   */
+  bool RunUntilEmpty()
+  {
+    for (double time = 0; time < MaximumRunTime && !mConveyor->GetProducts().empty(); time += RunStep)
+    {
+      mConveyor->Advance(RunStep);
+    }
+
+    return mConveyor->GetProducts().empty();
+  }
+};
+
+TEST_F(ConveyorTest, Finishes)
+{
+  mConveyor->Start();
+  ASSERT_TRUE(mConveyor->IsRunning());
+  ASSERT_LT(0, mConveyor->GetInFlight());
+
+  ASSERT_TRUE(RunUntilFinished());
+  ASSERT_EQ(0, mConveyor->GetInFlight(false));
+  ASSERT_EQ(0, mConveyor->GetInFlight(true));
+}
+
+TEST_F(ConveyorTest, FinishesWithProductsOffScreen)
+{
+  // The first products start below the bottom of the game,
+  // so they are never in flight
+  auto source = std::make_unique<XmlProductSource>();
+  for (double placement : {-5000.0, -4000.0, 0.0, 200.0})
+  {
+    ProductSpec spec;
+    spec.mPlacement = placement;
+    spec.mKick = placement < 0;
+    source->Add(spec);
+  }
+
+  mConveyor->SetSource(std::move(source));
+  mConveyor->Start();
+  ASSERT_EQ(2, mConveyor->GetInFlight());
+
+  ASSERT_TRUE(RunUntilFinished());
+  ASSERT_EQ(0, mConveyor->GetInFlight(false));
+  ASSERT_EQ(0, mConveyor->GetInFlight(true));
+
+  // Starting again brings back the same products
+  mConveyor->Start();
+  ASSERT_EQ(2, mConveyor->GetInFlight());
+  ASSERT_TRUE(RunUntilFinished());
+  ASSERT_EQ(0, mConveyor->GetInFlight());
+}
+
+TEST_F(ConveyorTest, KickedWhileStopped)
+{
+  SetBeamProduct(true);
+  mConveyor->Start();
+  mConveyor->Advance(RunStep);
+  mConveyor->Stop();
+
+  ASSERT_EQ(1u, mConveyor->GetProducts().size());
+  auto product = mConveyor->GetProducts().front().get();
+  const double x = product->GetX();
+  const double y = product->GetY();
+
+  mConveyor->ScheduleKick(0);
+  ASSERT_TRUE(product->IsMovingLeft());
+
+  // The product moves left even though the belt does not
+  mConveyor->Advance(RunStep);
+  ASSERT_LT(product->GetX(), x);
+  ASSERT_DOUBLE_EQ(y, product->GetY());
+
+  ASSERT_TRUE(RunUntilEmpty());
+  ASSERT_FALSE(mConveyor->IsRunning());
+}
+
+TEST_F(ConveyorTest, FinishesWhenKickedWhileStopped)
+{
+  SetBeamProduct(true);
+  ASSERT_FALSE(mConveyor->IsFinished());
+
+  mConveyor->Start();
+  mConveyor->Advance(RunStep);
+  mConveyor->Stop();
+  ASSERT_FALSE(mConveyor->IsFinished());
+
+  // Kicking the last product ends the line without starting it again
+  mConveyor->ScheduleKick(0);
+  ASSERT_EQ(0, mConveyor->GetInFlight());
+  ASSERT_TRUE(mConveyor->IsFinished());
+}
+
+TEST_F(ConveyorTest, SpartyKicksAtKickPoint)
+{
+  SetBeamProduct(true);
+  mConveyor->Start();
+  mConveyor->Advance(RunStep);
+
+  auto product = mConveyor->GetProducts().front().get();
+  KickWithSparty();
+
+  // Nothing is kicked until the boot reaches the belt
+  mConveyor->Advance(KickDelay - 0.005);
+  ASSERT_FALSE(product->IsMovingLeft());
+
+  mConveyor->Advance(0.01);
+  ASSERT_TRUE(product->IsMovingLeft());
+
+  // The product should have been kicked, so it is scored as correct
+  mLine->ApplyOutcomes();
+  ASSERT_EQ(1u, mLine->GetLedger().size());
+  ASSERT_EQ(1, mLine->GetCorrectCount());
+
+  ASSERT_TRUE(RunUntilFinished());
+  ASSERT_TRUE(RunUntilEmpty());
+}
+
+TEST_F(ConveyorTest, SpartyKicksWhileStopped)
+{
+  SetBeamProduct(false);
+  mConveyor->Start();
+  mConveyor->Advance(RunStep);
+  mConveyor->Stop();
+
+  // The belt is stopped, so the kick happens right away
+  auto product = mConveyor->GetProducts().front().get();
+  KickWithSparty();
+  ASSERT_TRUE(product->IsMovingLeft());
+
+  // The product should not have been kicked
+  mLine->ApplyOutcomes();
+  ASSERT_EQ(1u, mLine->GetLedger().size());
+  ASSERT_EQ(1, mLine->GetIncorrectCount());
+  ASSERT_TRUE(mConveyor->IsFinished());
+
+  // It still goes off the screen
+  ASSERT_TRUE(RunUntilEmpty());
+}
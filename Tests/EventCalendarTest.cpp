@@ -0,0 +1,73 @@
+/**
+ * @file EventCalendarTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <EventCalendar.h>
+#include <Items/Product.h>
+
+using EventType = EventCalendar::EventType;
+
+class EventCalendarTest : public ::testing::Test
+{
+protected:
+  Game mGame;
+
+  Product mProduct1{&mGame, 0, Product::Properties::Square, Product::Properties::Red};
+  Product mProduct2{&mGame, 0, Product::Properties::Circle, Product::Properties::Blue};
+};
+
+TEST_F(EventCalendarTest, Order)
+{
+  EventCalendar calendar;
+  calendar.Schedule(2.0, EventType::BeamLeave, &mProduct1);
+  calendar.Schedule(0.5, EventType::SensorEnter, &mProduct2);
+  calendar.Schedule(1.0, EventType::BeamEnter, &mProduct1);
+  calendar.Schedule(1.0, EventType::BeamEnter, &mProduct2);
+
+  EventCalendar::Event event;
+
+  // Nothing happens before the first event
+  ASSERT_FALSE(calendar.PopNext(0.25, event));
+
+  // A single large step still gets every event, in time order
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(0.5, event.mTime);
+  ASSERT_EQ(EventType::SensorEnter, event.mType);
+
+  // Ties come out in the order they were scheduled
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(&mProduct1, event.mProduct);
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(&mProduct2, event.mProduct);
+
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(2.0, event.mTime);
+  ASSERT_FALSE(calendar.PopNext(5.0, event));
+  ASSERT_TRUE(calendar.IsEmpty());
+}
+
+TEST_F(EventCalendarTest, Cancel)
+{
+  EventCalendar calendar;
+  calendar.Schedule(1.0, EventType::BeamEnter, &mProduct1);
+  calendar.Schedule(1.5, EventType::BeamEnter, &mProduct2);
+  calendar.Schedule(2.0, EventType::BeamLeave, &mProduct1);
+
+  // Cancelled events are skipped
+  calendar.Cancel(&mProduct1);
+
+  EventCalendar::Event event;
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(&mProduct2, event.mProduct);
+  ASSERT_FALSE(calendar.PopNext(5.0, event));
+
+  // Events scheduled after the cancel still happen
+  calendar.Schedule(3.0, EventType::OffScreen, &mProduct1);
+  ASSERT_TRUE(calendar.PopNext(5.0, event));
+  ASSERT_EQ(EventType::OffScreen, event.mType);
+}
@@ -16,6 +16,7 @@
 #include <Items/Conveyor.h>
 #include <Gates/Sparty.h>
 #include <Gates/Beam.h>
+#include <Gates/ANDGate.h>
 
 class TestLocationVisitor : public ItemVisitor
 {
@@ -70,18 +71,65 @@ TEST_F(GameTest, Load)
   Game game;
 
   game.LoadLevel(0);
-  std::deque<std::shared_ptr<Item>> items0 = game.GetItems();
 
-  // Test level 0 - 19 items
-  // 18 in the XML file - 1 badge (new feature) and 1 level notice
-  ASSERT_EQ(20, items0.size());
+  // Test level 0 - 14 items
+  // 12 in the XML file - 1 badge (new feature) and 1 level notice
+  // The 6 products are on the conveyor, not in the game
+  ASSERT_EQ(14, game.GetItemCount());
 
   // Test level 1
   game.LoadLevel(1);
-  std::deque<std::shared_ptr<Item>> items1 = game.GetItems();
-  // 8 in the XML file - 1 badge (new feature) and 1 level notice
-  ASSERT_EQ(10, items1.size());
+  // 4 in the XML file - 1 badge (new feature) and 1 level notice
+  // The 4 products are on the conveyor, not in the game
+  ASSERT_EQ(6, game.GetItemCount());
 
   TestLocationVisitor visitor;
   TestItemLocations(game, visitor);
 }
+
+TEST_F(GameTest, AddRemove)
+{
+  Game game;
+  game.LoadLevel(1);
+  const auto count = game.GetItemCount();
+
+  auto gate = std::make_shared<ANDGate>(&game);
+  game.Add(gate);
+  ASSERT_EQ(count + 1, game.GetItemCount());
+  ASSERT_EQ(gate, game.GetGates().back());
+
+  game.Remove(gate.get());
+  ASSERT_EQ(count, game.GetItemCount());
+}
+
+TEST_F(GameTest, DeleteGate)
+{
+  Game game;
+  game.LoadLevel(1);
+  const auto count = game.GetItemCount();
+
+  auto source = std::make_shared<ANDGate>(&game);
+  auto sink = std::make_shared<ANDGate>(&game);
+  source->SetLocation(200, 200);
+  sink->SetLocation(500, 500);
+  game.Add(source);
+  game.Add(sink);
+
+  source->GetOutputPins()[0].SetState(States::One);
+  source->GetOutputPins()[0].SetCaught(&sink->GetInputPins()[0]);
+  ASSERT_EQ(States::One, sink->GetInputPins()[0].GetState());
+
+  // Nothing to delete away from the gates
+  ASSERT_FALSE(game.DeleteGate(0, 0));
+
+  auto handle = source->GetHandle();
+  ASSERT_EQ(source.get(), game.GetItem(handle));
+  ASSERT_TRUE(game.DeleteGate(200, 200));
+  ASSERT_EQ(count + 1, game.GetItemCount());
+  ASSERT_EQ(nullptr, game.GetItem(handle));
+
+  // The wire from the deleted gate goes away with its pins
+  source.reset();
+  sink->GetInputPins()[0].Update();
+  ASSERT_EQ(States::Unknown, sink->GetInputPins()[0].GetState());
+}
@@ -21,6 +21,7 @@
 #include <Gates/SensorGate.h>
 #include <Gates/Sparty.h>
 #include <Gates/SRFlipFlop.h>
+#include <Visitors/StaticItemVisitor.h>
 
 class TestVisitor : public ItemVisitor
 {
@@ -153,4 +154,54 @@ TEST (VisitorTest, ItemVisitor)
   ASSERT_EQ(8, visitor.mNumSensorGates) << L"Visitor number of Sensor Gates";
   ASSERT_EQ(2, visitor.mNumSpartys) << L"Visitor number of Spartys";
   ASSERT_EQ(1, visitor.mNumSRFlipFlops) << L"Visitor number of SR Flip Flop Gates";
-}
\ No newline at end of file
+}
+/**
+ * Compile time visitor that counts products and gates
+ */
+class TestStaticVisitor : public StaticItemVisitor<TestStaticVisitor>
+{
+public:
+  int mNumProducts = 0;
+  void VisitProduct(Product *product) { mNumProducts++; }
+
+  int mNumSensorGates = 0;
+  void VisitSensorGate(SensorGate *sensorGate) { mNumSensorGates++; }
+
+  int mNumGates = 0;
+  void VisitGates(Gate *gate) { mNumGates++; }
+};
+
+/**
+ * Compile time visitor that only counts level notices
+ */
+class TestNoticeVisitor : public StaticItemVisitor<TestNoticeVisitor>
+{
+public:
+  int mNumLevelNotices = 0;
+  void VisitLevelNotice(LevelNotice *levelNotice) { mNumLevelNotices++; }
+};
+
+TEST(VisitorTest, StaticItemVisitor)
+{
+  static_assert(TestStaticVisitor::HandlesProducts() && TestStaticVisitor::HandlesGates());
+  static_assert(!TestNoticeVisitor::HandlesDecor() && !TestNoticeVisitor::HandlesGates());
+
+  Game game;
+  game.LoadLevel(0);
+
+  TestVisitor visitor;
+  game.Accept(&visitor);
+
+  TestStaticVisitor staticVisitor;
+  game.Visit(staticVisitor);
+
+  ASSERT_EQ(visitor.mNumProducts, staticVisitor.mNumProducts);
+  ASSERT_EQ(visitor.mNumSensorGates, staticVisitor.mNumSensorGates);
+
+  // The sensor gates, beam and Sparty
+  ASSERT_EQ(9, staticVisitor.mNumGates);
+
+  TestNoticeVisitor noticeVisitor;
+  game.Visit(noticeVisitor);
+  ASSERT_EQ(1, noticeVisitor.mNumLevelNotices);
+}
@@ -0,0 +1,36 @@
+/**
+ * @file GraphicsResourcesTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <GraphicsResources.h>
+
+TEST(GraphicsResourcesTest, Reuse)
+{
+  wxImage target(100, 100);
+  std::shared_ptr<wxGraphicsContext> graphics(wxGraphicsContext::Create(target));
+
+  GraphicsResources resources;
+
+  // Drawing the same things twice makes nothing new
+  for (int frame = 0; frame < 2; frame++)
+  {
+    resources.GetPen(graphics, *wxBLACK);
+    resources.GetPen(graphics, *wxBLACK, 3);
+    resources.GetBrush(graphics, *wxWHITE);
+    resources.GetFont(graphics, 15, *wxBLACK);
+    ASSERT_EQ(4u, resources.GetCount());
+  }
+
+  // Any difference is a different object
+  resources.GetPen(graphics, *wxRED, 3);
+  resources.GetBrush(graphics, *wxBLACK);
+  resources.GetFont(graphics, 25, *wxBLACK);
+  ASSERT_EQ(7u, resources.GetCount());
+
+  resources.Clear();
+  ASSERT_EQ(0u, resources.GetCount());
+}
@@ -0,0 +1,40 @@
+/**
+ * @file ItemRegistryTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <ItemRegistry.h>
+#include <Items/Product.h>
+
+TEST(ItemRegistryTest, Properties)
+{
+  ASSERT_EQ(Product::Properties::Red, Product::FindProperty(L"red"));
+  ASSERT_EQ(Product::Properties::Basketball, Product::FindProperty(L"basketball"));
+  ASSERT_EQ(Product::Properties::None, Product::FindProperty(L"none"));
+  ASSERT_FALSE(Product::FindProperty(L"purple").has_value());
+  ASSERT_FALSE(Product::FindProperty(L"").has_value());
+}
+
+TEST(ItemRegistryTest, Tags)
+{
+  Game game;
+  ProductionLine line;
+
+  auto conveyor = LevelItemRegistry<LevelItemTypes>::Create(L"conveyor", &game, &line);
+  ASSERT_EQ(ItemType::Conveyor, conveyor->GetType());
+  ASSERT_EQ(conveyor.get(), line.GetConveyor());
+
+  auto scoreboard = LevelItemRegistry<LevelItemTypes>::Create(L"scoreboard", &game, &line);
+  ASSERT_EQ(ItemType::Scoreboard, scoreboard->GetType());
+
+  ASSERT_EQ(nullptr, LevelItemRegistry<LevelItemTypes>::Create(L"line", &game, &line));
+  ASSERT_EQ(nullptr, LevelItemRegistry<LevelItemTypes>::Create(L"product", &game, &line));
+
+  const auto &gates = GateMenu<MenuGateTypes>::Entries;
+  ASSERT_EQ(5u, gates.size());
+  ASSERT_EQ(ItemType::ANDGate, gates[0].mCreate(&game)->GetType());
+  ASSERT_EQ(ItemType::DFlipFlop, gates[4].mCreate(&game)->GetType());
+}
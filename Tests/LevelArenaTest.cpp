@@ -0,0 +1,59 @@
+/**
+ * @file LevelArenaTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <LevelArena.h>
+#include <Game.h>
+#include <Gates/ANDGate.h>
+
+TEST(LevelArenaTest, Live)
+{
+  LevelArena arena;
+  ASSERT_EQ(0u, arena.GetLive());
+
+  auto a = arena.Make<int>(1);
+  auto b = arena.Make<double>(2.0);
+  ASSERT_EQ(2u, arena.GetLive());
+  ASSERT_EQ(1, *a);
+
+  // Freed memory is reused for the next object of the same size
+  auto address = a.get();
+  a.reset();
+  ASSERT_EQ(1u, arena.GetLive());
+  auto c = arena.Make<int>(3);
+  ASSERT_EQ(address, c.get());
+}
+
+TEST(LevelArenaTest, Gate)
+{
+  Game game;
+  const auto live = game.GetArena().GetLive();
+
+  // The gate comes from the arena with its three pins inside it
+  auto gate = game.GetArena().Make<ANDGate>(&game);
+  ASSERT_EQ(live + 1, game.GetArena().GetLive());
+
+  gate.reset();
+  ASSERT_EQ(live, game.GetArena().GetLive());
+}
+
+TEST(LevelArenaTest, HeldAcrossLevels)
+{
+  Game game;
+  auto &first = game.GetArena();
+  auto gate = first.Make<ANDGate>(&game);
+
+  // The arena is kept while something still holds the gate
+  game.LoadLevel(0);
+  ASSERT_NE(&first, &game.GetArena());
+  ASSERT_EQ(1u, first.GetLive());
+
+  // Once it is let go the arena is empty and can be destroyed
+  gate.reset();
+  ASSERT_EQ(0u, first.GetLive());
+  game.LoadLevel(1);
+}
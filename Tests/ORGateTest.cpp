@@ -37,13 +37,13 @@ protected:
     {
       for (size_t i = 0; i < numInputPins; i++)
       {
-        inputPins[i]->SetState(row[i]);
+        inputPins[i].SetState(row[i]);
       }
       orGate->ComputeState();
 
       for (size_t i = 0; i < numOutputPins; i++)
       {
-        EXPECT_EQ(outputPins[i]->GetState(), row[numInputPins + i]);
+        EXPECT_EQ(outputPins[i].GetState(), row[numInputPins + i]);
       }
     }
   }
@@ -0,0 +1,99 @@
+/**
+ * @file ProductIndexTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <ProductIndex.h>
+#include <Items/Product.h>
+
+class ProductIndexTest : public ::testing::Test
+{
+protected:
+  Game mGame;
+
+  std::vector<std::shared_ptr<Product>> mProducts;
+
+  /**
+   * Create products at the given Y locations
+   * @param ys Y location of each product
+   * @return Raw pointers to the products
+   */
+  std::vector<Product *> MakeProducts(const std::vector<double> &ys)
+  {
+    std::vector<Product *> products;
+    for (auto y : ys)
+    {
+      auto product = std::make_shared<Product>(&mGame, 0, Product::Properties::Square, Product::Properties::Red);
+      product->SetY(y);
+      mProducts.push_back(product);
+      products.push_back(product.get());
+    }
+
+    return products;
+  }
+};
+
+TEST_F(ProductIndexTest, Query)
+{
+  // Products come onto the belt at the top, so each one is above the last
+  auto products = MakeProducts({437, 420, 300, 150, 0, -150});
+
+  ProductIndex index;
+  for (auto product : products)
+  {
+    index.AddTop(product);
+  }
+  ASSERT_EQ(6, index.GetSize());
+
+  // Exclusive bounds around the beam
+  std::vector<Product *> found;
+  for (auto product : index.Query(397, 477))
+  {
+    found.push_back(product);
+  }
+  ASSERT_EQ(2, found.size());
+  ASSERT_EQ(products[1], found[0]);
+  ASSERT_EQ(products[0], found[1]);
+
+  ASSERT_TRUE(index.Query(437, 477).empty());
+  ASSERT_TRUE(index.Query(300.5, 400).empty());
+  ASSERT_EQ(6, std::distance(index.Query(-200, 500).begin(), index.Query(-200, 500).end()));
+}
+
+TEST_F(ProductIndexTest, Remove)
+{
+  auto products = MakeProducts({300, 200, 100});
+
+  ProductIndex index;
+  for (auto product : products)
+  {
+    index.AddTop(product);
+  }
+
+  // Kicked products leave the index
+  index.Remove(products[1]);
+  ASSERT_EQ(2, index.GetSize());
+  ASSERT_TRUE(index.Query(150, 250).empty());
+
+  // The rest stay in order
+  std::vector<Product *> found(index.Query(0, 400).begin(), index.Query(0, 400).end());
+  ASSERT_EQ(2, found.size());
+  ASSERT_EQ(products[2], found[0]);
+  ASSERT_EQ(products[0], found[1]);
+
+  // Products go off the bottom of the belt in order
+  index.RemoveBottom(products[0]);
+  ASSERT_EQ(1, index.GetSize());
+  ASSERT_TRUE(index.Query(250, 400).empty());
+
+  // Removing a product that is not in the index does nothing
+  index.Remove(products[1]);
+  ASSERT_EQ(1, index.GetSize());
+
+  index.Clear();
+  ASSERT_EQ(0, index.GetSize());
+}
@@ -0,0 +1,152 @@
+/**
+ * @file ProductSourceTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Sources/FileProductSource.h>
+#include <Sources/RandomProductSource.h>
+#include <Sources/XmlProductSource.h>
+
+#include <filesystem>
+#include <fstream>
+
+using Properties = Product::Properties;
+
+/**
+ * Read every product from a source
+ * @param source The source
+ * @return The products
+ */
+static std::vector<ProductSpec> ReadAll(ProductSource &source)
+{
+  std::vector<ProductSpec> products;
+  ProductSpec spec;
+  while (source.Next(spec))
+  {
+    products.push_back(spec);
+  }
+
+  return products;
+}
+
+TEST(ProductSourceTest, ParsePlacement)
+{
+  ASSERT_DOUBLE_EQ(300, ProductSource::ParsePlacement(L"300", 100));
+  ASSERT_DOUBLE_EQ(250, ProductSource::ParsePlacement(L"+150", 100));
+  ASSERT_DOUBLE_EQ(0, ProductSource::ParsePlacement(L"", 100));
+}
+
+TEST(ProductSourceTest, Xml)
+{
+  // Products listed out of order come out in placement order
+  XmlProductSource source;
+  const std::vector<std::pair<double, bool>> listed = {{100, false}, {400, true}, {250, false}, {400, false}, {50, false}};
+  for (const auto &[placement, kick] : listed)
+  {
+    ProductSpec spec;
+    spec.mPlacement = placement;
+    spec.mKick = kick;
+    source.Add(spec);
+  }
+
+  auto products = ReadAll(source);
+  ASSERT_EQ(5u, products.size());
+  for (size_t i = 1; i < products.size(); i++)
+  {
+    ASSERT_LE(products[i - 1].mPlacement, products[i].mPlacement);
+  }
+
+  // Products at the same placement stay in the order they were added
+  ASSERT_TRUE(products[3].mKick);
+  ASSERT_FALSE(products[4].mKick);
+
+  source.Rewind();
+  ASSERT_EQ(5u, ReadAll(source).size());
+}
+
+TEST(ProductSourceTest, Random)
+{
+  RandomProductSource source(42, 20, 150, {{Properties::Square, 1}, {Properties::Circle, 1}},
+                             {{Properties::Red, 1}, {Properties::Green, 2}}, {{Properties::None, 1}},
+                             {Properties::Circle});
+
+  auto first = ReadAll(source);
+  ASSERT_EQ(20u, first.size());
+  ASSERT_DOUBLE_EQ(150, first[0].mPlacement);
+  ASSERT_DOUBLE_EQ(3000, first.back().mPlacement);
+
+  for (const auto &spec : first)
+  {
+    ASSERT_EQ(spec.mShape == Properties::Circle, spec.mKick);
+  }
+
+  // Rewinding gives the same products again
+  source.Rewind();
+  auto second = ReadAll(source);
+  ASSERT_EQ(first.size(), second.size());
+  for (size_t i = 0; i < first.size(); i++)
+  {
+    ASSERT_EQ(first[i].mShape, second[i].mShape);
+    ASSERT_EQ(first[i].mColor, second[i].mColor);
+  }
+
+  // So does another source with the same seed
+  RandomProductSource same(42, 20, 150, {{Properties::Square, 1}, {Properties::Circle, 1}},
+                           {{Properties::Red, 1}, {Properties::Green, 2}}, {{Properties::None, 1}},
+                           {Properties::Circle});
+  auto third = ReadAll(same);
+  for (size_t i = 0; i < first.size(); i++)
+  {
+    ASSERT_EQ(first[i].mShape, third[i].mShape);
+    ASSERT_EQ(first[i].mColor, third[i].mColor);
+  }
+}
+
+TEST(ProductSourceTest, File)
+{
+  const auto filename = std::filesystem::temp_directory_path() / "ProductSourceTest.txt";
+  {
+    std::wofstream file(filename);
+    file << L"# A comment\n"
+         << L"\n"
+         << L"100 square red\n"
+         << L"+150 circle green izzo yes\n"
+         << L"   \n"
+         << L"300 triangle red\n"
+         << L"+50 square blue no\n"
+         << L"200 square red\n"
+         << L"400 circle red yes\n";
+  }
+
+  FileProductSource source(filename.wstring());
+  auto products = ReadAll(source);
+
+  // The comment, the blank lines, the unknown shape and the
+  // product placed before the one above it are skipped
+  ASSERT_EQ(4u, products.size());
+
+  ASSERT_DOUBLE_EQ(100, products[0].mPlacement);
+  ASSERT_EQ(Properties::Square, products[0].mShape);
+  ASSERT_EQ(Properties::None, products[0].mContent);
+  ASSERT_FALSE(products[0].mKick);
+
+  ASSERT_DOUBLE_EQ(250, products[1].mPlacement);
+  ASSERT_EQ(Properties::Izzo, products[1].mContent);
+  ASSERT_TRUE(products[1].mKick);
+
+  ASSERT_DOUBLE_EQ(300, products[2].mPlacement);
+  ASSERT_EQ(Properties::Blue, products[2].mColor);
+
+  // A kick can take the place of the content
+  ASSERT_DOUBLE_EQ(400, products[3].mPlacement);
+  ASSERT_TRUE(products[3].mKick);
+
+  // Rewinding reads the file again from the start
+  source.Rewind();
+  ASSERT_EQ(4u, ReadAll(source).size());
+
+  std::filesystem::remove(filename);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file ProductionLineTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <ProductionLine.h>
+#include <Score.h>
+#include <Items/Conveyor.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+/// Time step for running the game in seconds
+static const double UpdateStep = 0.03;
+
+/// Most steps a test runs the game for
+static const int MaximumSteps = 10000;
+
+/// Number of lines in the parallel level, enough to update them on the thread pool
+static const int ParallelLines = 6;
+
+/// Number of products on each line of the parallel level
+static const int LineProducts = 3;
+
+/**
+ * Update the game until a condition holds or it runs out of steps
+ * @param game The game
+ * @param done The condition
+ * @return True if the condition holds
+ */
+template <class Condition>
+static bool UpdateUntil(Game &game, Condition done)
+{
+  for (int step = 0; step < MaximumSteps && !done(); step++)
+  {
+    game.Update(UpdateStep);
+  }
+
+  return done();
+}
+
+TEST(ProductionLineTest, RestartScoresOnce)
+{
+  Game game;
+  game.LoadLevel(0);
+
+  auto line = game.GetLines().front().get();
+  auto conveyor = line->GetConveyor();
+  auto score = game.GetScore();
+  ASSERT_NE(nullptr, conveyor);
+
+  // Part of the way through the products
+  conveyor->Start();
+  ASSERT_TRUE(UpdateUntil(game, [line] { return line->GetLedger().size() >= 2; }));
+  ASSERT_EQ(int(line->GetLedger().size()), score->GetCorrectCount() + score->GetIncorrectCount());
+
+  // Starting again takes the first run's scores back out
+  conveyor->Start();
+  game.Update(0);
+  ASSERT_TRUE(line->GetLedger().empty());
+  ASSERT_EQ(0, score->GetLevelScore());
+
+  // Each of the 6 products is scored once
+  ASSERT_TRUE(UpdateUntil(game, [line] { return line->IsFinished(); }));
+  ASSERT_EQ(6u, line->GetLedger().size());
+  ASSERT_EQ(6, score->GetCorrectCount() + score->GetIncorrectCount());
+  ASSERT_EQ(line->GetCorrectCount() * 10 + line->GetIncorrectCount() * -5, score->GetLevelScore());
+}
+
+TEST(ProductionLineTest, ParallelLines)
+{
+  // A level with a line of its own for each conveyor
+  const auto filename = std::filesystem::temp_directory_path() / "ProductionLineTest.xml";
+  {
+    std::wofstream file(filename);
+    file << L"<?xml version='1.0' encoding='UTF-8'?>\n"
+         << L"<level size=\"" << ParallelLines * 450 << L",800\"><items>\n";
+    for (int i = 0; i < ParallelLines; i++)
+    {
+      const int x = i * 450;
+      file << L"<line>\n"
+           << L"<sensor x=\"" << x + 155 << L"\" y=\"430\"><red/></sensor>\n"
+           << L"<conveyor x=\"" << x + 205 << L"\" y=\"400\" speed=\"200\" height=\"800\" panel=\"60,-390\">\n"
+           << L"<product placement=\"100\" shape=\"square\" color=\"red\"/>\n"
+           << L"<product placement=\"+150\" shape=\"circle\" color=\"green\"/>\n"
+           << L"<product placement=\"+150\" shape=\"diamond\" color=\"blue\"/>\n"
+           << L"</conveyor>\n"
+           << L"<beam x=\"" << x + 297 << L"\" y=\"437\" sender=\"-185\"/>\n"
+           << L"<sparty x=\"" << x + 345 << L"\" y=\"340\" height=\"300\" pin=\"" << x + 440
+           << L", 500\" kick-duration=\"0.25\" kick-speed=\"1000\"/>\n"
+           << L"</line>\n";
+    }
+    file << L"<scoreboard x=\"700\" y=\"690\" good=\"10\" bad=\"-5\">Parallel lines</scoreboard>\n"
+         << L"</items></level>\n";
+  }
+
+  Game game;
+  game.Load(filename.wstring());
+  std::filesystem::remove(filename);
+
+  // The items outside of a line make up a first line with no conveyor
+  std::vector<ProductionLine *> lines;
+  for (const auto &line : game.GetLines())
+  {
+    if (line->GetConveyor() != nullptr)
+    {
+      lines.push_back(line.get());
+      line->GetConveyor()->Start();
+    }
+  }
+
+  ASSERT_EQ(size_t(ParallelLines), lines.size());
+
+  auto finished = [&lines] {
+    return std::all_of(lines.begin(), lines.end(), [](ProductionLine *line) { return line->IsFinished(); });
+  };
+
+  int steps = 0;
+  for (; steps < MaximumSteps && !finished(); steps++)
+  {
+    game.Update(UpdateStep);
+  }
+
+  ASSERT_TRUE(finished());
+
+  // Every line moved once per update and scored each of its products once
+  for (auto line : lines)
+  {
+    ASSERT_NEAR(steps * UpdateStep, line->GetConveyor()->GetKickClock(), 1e-9);
+    ASSERT_EQ(size_t(LineProducts), line->GetLedger().size());
+    ASSERT_EQ(LineProducts, line->GetCorrectCount());
+  }
+
+  auto score = game.GetScore();
+  ASSERT_EQ(ParallelLines * LineProducts, score->GetCorrectCount());
+  ASSERT_EQ(0, score->GetIncorrectCount());
+
+  // The level ends and its score goes into the game score once
+  const int levelScore = score->GetLevelScore();
+  ASSERT_EQ(ParallelLines * LineProducts * 10, levelScore);
+  ASSERT_TRUE(UpdateUntil(game, [score] { return score->GetGameScore() != 0; }));
+  ASSERT_EQ(levelScore, score->GetGameScore());
+  ASSERT_EQ(0, score->GetLevelScore());
+}
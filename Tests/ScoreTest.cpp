@@ -0,0 +1,71 @@
+/**
+ * @file ScoreTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Score.h>
+#include <IScoreObserver.h>
+
+/**
+ * Observer that counts how often it is told the score changed
+ */
+class TestScoreObserver : public IScoreObserver
+{
+public:
+  int mChanges = 0;
+  int mLastLevelScore = 0;
+
+  void ScoreChanged(Score *score) override
+  {
+    mChanges++;
+    mLastLevelScore = score->GetLevelScore();
+  }
+};
+
+TEST(ScoreTest, Observers)
+{
+  Score score;
+  score.SetGoodScore(10);
+  score.SetBadScore(-5);
+
+  TestScoreObserver observer;
+  score.AddObserver(&observer);
+
+  score.SetLevelOutcomes(1, 0);
+  score.SetLevelOutcomes(2, 1);
+  ASSERT_EQ(2, observer.mChanges);
+  ASSERT_EQ(15, observer.mLastLevelScore);
+
+  // Nothing changed, so the observers are not told
+  score.SetLevelOutcomes(2, 1);
+  ASSERT_EQ(2, observer.mChanges);
+
+  score.RemoveObserver(&observer);
+  score.SetLevelOutcomes(3, 1);
+  ASSERT_EQ(2, observer.mChanges);
+}
+
+TEST(ScoreTest, Outcomes)
+{
+  Score score;
+  score.SetGoodScore(10);
+  score.SetBadScore(-5);
+
+  score.SetLevelOutcomes(2, 1);
+  ASSERT_EQ(2, score.GetCorrectCount());
+  ASSERT_EQ(1, score.GetIncorrectCount());
+  ASSERT_EQ(15, score.GetLevelScore());
+
+  // A line that starts over takes its outcomes back out
+  score.SetLevelOutcomes(1, 0);
+  ASSERT_EQ(10, score.GetLevelScore());
+
+  score.EndLevel();
+  ASSERT_EQ(0, score.GetCorrectCount());
+  ASSERT_EQ(0, score.GetIncorrectCount());
+  ASSERT_EQ(0, score.GetLevelScore());
+  ASSERT_EQ(10, score.GetGameScore());
+}
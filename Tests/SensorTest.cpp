@@ -0,0 +1,147 @@
+/**
+ * @file SensorTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <ProductionLine.h>
+#include <Items/Conveyor.h>
+#include <Gates/Beam.h>
+#include <Gates/SensorGate.h>
+#include <Sources/XmlProductSource.h>
+#include <Visitors/ItemVisitor.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+using Properties = Product::Properties;
+
+/**
+ * Visitor that finds the sensor gates in a game
+ */
+class SensorGateFinder : public ItemVisitor
+{
+public:
+  /// The sensor gates found
+  std::vector<SensorGate *> mGates;
+
+  void VisitSensorGate(SensorGate *gate) override { mGates.push_back(gate); }
+};
+
+class SensorTest : public ::testing::Test
+{
+protected:
+  /// The game
+  Game mGame;
+
+  /// The only line of the level
+  ProductionLine *mLine = nullptr;
+
+  /// A sensor gate for every property
+  std::vector<SensorGate *> mGates;
+
+  void SetUp() override
+  {
+    // A level with a sensor that tests for every property
+    const auto filename = std::filesystem::temp_directory_path() / "SensorTest.xml";
+    {
+      std::wofstream file(filename);
+      file << L"<?xml version='1.0' encoding='UTF-8'?>\n"
+           << L"<level size=\"1150,800\"><items>\n"
+           << L"<sensor x=\"155\" y=\"430\">"
+           << L"<none/><red/><green/><blue/><white/><square/><circle/><diamond/>"
+           << L"<izzo/><smith/><football/><basketball/></sensor>\n"
+           << L"<conveyor x=\"205\" y=\"400\" speed=\"100\" height=\"800\" panel=\"60,-390\"/>\n"
+           << L"<beam x=\"297\" y=\"437\" sender=\"-185\"/>\n"
+           << L"</items></level>\n";
+    }
+
+    mGame.Load(filename.wstring());
+    std::filesystem::remove(filename);
+
+    mLine = mGame.GetLines().front().get();
+    ASSERT_NE(nullptr, mLine->GetConveyor());
+    ASSERT_NE(nullptr, mLine->GetBeam());
+
+    SensorGateFinder finder;
+    mGame.Accept(&finder);
+    mGates = finder.mGates;
+    ASSERT_EQ(12u, mGates.size());
+  }
+
+  /**
+   * Put one product on the conveyor and let the sensor look at it
+   * @param placement Placement of the product
+   * @param shape Shape of the product
+   * @param color Color of the product
+   * @param content Content of the product
+   * @return The properties of the sensor gates that are high
+   */
+  std::set<Properties> Sense(double placement, Properties shape, Properties color, Properties content)
+  {
+    ProductSpec spec;
+    spec.mPlacement = placement;
+    spec.mShape = shape;
+    spec.mColor = color;
+    spec.mContent = content;
+
+    auto source = std::make_unique<XmlProductSource>();
+    source->Add(spec);
+
+    auto conveyor = mLine->GetConveyor();
+    conveyor->SetSource(std::move(source));
+    conveyor->Start();
+    mGame.Update(0);
+
+    std::set<Properties> high;
+    for (auto gate : mGates)
+    {
+      if (gate->GetState() == States::One)
+      {
+        high.insert(gate->GetProperty());
+      }
+    }
+
+    return high;
+  }
+
+  /**
+   * Put one product in the sensor window and let the sensor look at it
+   * @param shape Shape of the product
+   * @param color Color of the product
+   * @param content Content of the product
+   * @return The properties of the sensor gates that are high
+   */
+  std::set<Properties> SenseInWindow(Properties shape, Properties color, Properties content)
+  {
+    return Sense(mLine->GetConveyor()->GetY() - mLine->GetBeam()->GetY(), shape, color, content);
+  }
+};
+
+TEST_F(SensorTest, GatesMatchProperties)
+{
+  ASSERT_EQ(std::set<Properties>({Properties::Square, Properties::Red, Properties::None}),
+            SenseInWindow(Properties::Square, Properties::Red, Properties::None));
+
+  ASSERT_EQ(std::set<Properties>({Properties::Circle, Properties::Green, Properties::Izzo}),
+            SenseInWindow(Properties::Circle, Properties::Green, Properties::Izzo));
+
+  ASSERT_EQ(std::set<Properties>({Properties::Diamond, Properties::Blue, Properties::Smith}),
+            SenseInWindow(Properties::Diamond, Properties::Blue, Properties::Smith));
+
+  ASSERT_EQ(std::set<Properties>({Properties::Square, Properties::White, Properties::Football}),
+            SenseInWindow(Properties::Square, Properties::White, Properties::Football));
+
+  ASSERT_EQ(std::set<Properties>({Properties::Circle, Properties::Red, Properties::Basketball}),
+            SenseInWindow(Properties::Circle, Properties::Red, Properties::Basketball));
+}
+
+TEST_F(SensorTest, EmptyWindow)
+{
+  // A product far above the sensor window leaves every gate low
+  ASSERT_TRUE(Sense(1000, Properties::Square, Properties::Red, Properties::Izzo).empty());
+}
@@ -0,0 +1,37 @@
+/**
+ * @file SlotTableTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <SlotTable.h>
+
+TEST(SlotTableTest, Handles)
+{
+  SlotTable<int> table;
+  int a = 1, b = 2;
+
+  ASSERT_EQ(nullptr, table.Get(Handle()));
+
+  auto ha = table.Insert(&a);
+  auto hb = table.Insert(&b);
+  ASSERT_EQ(&a, table.Get(ha));
+  ASSERT_EQ(&b, table.Get(hb));
+  ASSERT_EQ(2u, table.GetCount());
+
+  // A removed object's handle goes stale even after its slot is reused
+  table.Remove(ha);
+  ASSERT_EQ(nullptr, table.Get(ha));
+  auto hc = table.Insert(&a);
+  ASSERT_EQ(ha.GetIndex(), hc.GetIndex());
+  ASSERT_NE(ha, hc);
+  ASSERT_EQ(nullptr, table.Get(ha));
+  ASSERT_EQ(&a, table.Get(hc));
+
+  // Removing with a stale handle leaves the new object alone
+  table.Remove(ha);
+  ASSERT_EQ(&a, table.Get(hc));
+  ASSERT_EQ(2u, table.GetCount());
+}
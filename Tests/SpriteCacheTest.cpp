@@ -0,0 +1,46 @@
+/**
+ * @file SpriteCacheTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <SpriteCache.h>
+
+TEST(SpriteCacheTest, Eviction)
+{
+  wxImage target(100, 100);
+  std::shared_ptr<wxGraphicsContext> graphics(wxGraphicsContext::Create(target));
+
+  wxImage a(10, 10), b(10, 10);
+
+  // Room for two 10x10 variants
+  SpriteCache cache(2 * 10 * 10 * 4);
+
+  cache.Get(graphics, {&a, false, 0, 10, 10});
+  cache.Get(graphics, {&a, false, 0, 10, 10});
+  ASSERT_EQ(1u, cache.GetCount());
+
+  // A mirrored variant is a different sprite
+  cache.Get(graphics, {&a, true, 0, 10, 10});
+  ASSERT_EQ(2u, cache.GetCount());
+  ASSERT_EQ(800u, cache.GetBytes());
+
+  // Use the plain variant so the mirrored one is the oldest,
+  // then a third variant pushes the mirrored one out
+  cache.Get(graphics, {&a, false, 0, 10, 10});
+  cache.Get(graphics, {&b, false, 0, 10, 10});
+  ASSERT_EQ(2u, cache.GetCount());
+  ASSERT_EQ(800u, cache.GetBytes());
+
+  // A variant bigger than the budget is still kept while it is
+  // the most recent one
+  cache.Get(graphics, {&b, false, 0, 20, 20});
+  ASSERT_EQ(1u, cache.GetCount());
+  ASSERT_EQ(1600u, cache.GetBytes());
+
+  cache.Clear();
+  ASSERT_EQ(0u, cache.GetCount());
+  ASSERT_EQ(0u, cache.GetBytes());
+}
@@ -0,0 +1,44 @@
+/**
+ * @file WireGraphTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Game.h>
+#include <Gates/ANDGate.h>
+
+TEST(WireGraphTest, Fanout)
+{
+  Game game;
+  auto &wires = game.GetWires();
+  const auto count = wires.GetWireCount();
+
+  auto a = std::make_shared<ANDGate>(&game);
+  auto b = std::make_shared<ANDGate>(&game);
+  auto c = std::make_shared<ANDGate>(&game);
+  auto &out = a->GetOutputPins()[0];
+
+  out.SetCaught(&b->GetInputPins()[0]);
+  out.SetCaught(&c->GetInputPins()[1]);
+  ASSERT_EQ(count + 2, wires.GetWireCount());
+  ASSERT_EQ(2u, wires.GetFanout(out.GetHandle()).size());
+  ASSERT_EQ(out.GetHandle(), wires.GetDriver(c->GetInputPins()[1].GetHandle()));
+
+  // Catching an input pin from another output moves its wire
+  b->GetOutputPins()[0].SetCaught(&c->GetInputPins()[1]);
+  ASSERT_EQ(count + 2, wires.GetWireCount());
+  ASSERT_EQ(1u, wires.GetFanout(out.GetHandle()).size());
+  ASSERT_EQ(b->GetInputPins()[0].GetHandle(), wires.GetFanout(out.GetHandle())[0]);
+
+  // Wires go away with the gates at either end
+  c.reset();
+  ASSERT_EQ(count + 1, wires.GetWireCount());
+  a.reset();
+  ASSERT_EQ(count, wires.GetWireCount());
+
+  // The input pin drops its stale driver when it next updates
+  b->GetInputPins()[0].Update();
+  ASSERT_TRUE(wires.GetDriver(b->GetInputPins()[0].GetHandle()).IsNull());
+}
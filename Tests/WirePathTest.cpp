@@ -0,0 +1,38 @@
+/**
+ * @file WirePathTest.cpp
+ * @author Nitish Maindoliya
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <WirePath.h>
+
+TEST(WirePathTest, HitTest)
+{
+  WirePath wire;
+
+  // A straight wire is easy to check
+  wire.SetEnds(wxPoint(0, 100), wxPoint(400, 100));
+  ASSERT_TRUE(wire.HitTest(200, 100));
+  ASSERT_TRUE(wire.HitTest(200, 103));
+  ASSERT_FALSE(wire.HitTest(200, 120));
+  ASSERT_FALSE(wire.HitTest(450, 100));
+
+  // The curve leaves each pin heading right and passes
+  // through the middle of the two ends
+  wire.SetEnds(wxPoint(0, 0), wxPoint(100, 200));
+  ASSERT_TRUE(wire.HitTest(50, 100));
+  ASSERT_TRUE(wire.HitTest(3, 0));
+  ASSERT_FALSE(wire.HitTest(0, 100));
+
+  // Moving an end moves the curve
+  wire.SetEnds(wxPoint(0, 0), wxPoint(100, 400));
+  ASSERT_FALSE(wire.HitTest(50, 100));
+  ASSERT_TRUE(wire.HitTest(50, 200));
+
+  // The curve and its control points stay inside its bounds
+  const auto bounds = WirePath::GetBounds(wxPoint(0, 0), wxPoint(100, 400), false);
+  ASSERT_TRUE(bounds.Contains(wxPoint(50, 200)));
+  ASSERT_TRUE(bounds.Contains(wxPoint(int(BezierMaxOffset), 0)));
+}